@@ -0,0 +1,177 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+
+#include "CoinPragma.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinTime.hpp"
+#include "OsiClpSolverInterface.hpp"
+#include "CbcModel.hpp"
+#include "CbcSolver.hpp"
+#include "CbcBatchSolver.hpp"
+
+//#############################################################################
+
+
+/************************************************************************
+
+This main program measures throughput when solving many small models.
+
+It generates knapsack and assignment problems and solves them
+
+1) one at a time with a new CbcModel and CbcMain0/CbcMain1 each (as
+   Cbc_newModel and Cbc_solve do)
+2) with CbcBatchSolver on one thread
+3) with CbcBatchSolver on several threads (if Cbc was built with
+   CBC_THREAD and CBC_THREAD_SAFE)
+
+and prints models per second and checks objectives agree.
+
+Arguments are number of models (default 1000), number of threads
+(default 4) and then any Cbc arguments e.g. -cuts off
+
+************************************************************************/
+
+// Seeded so all runs see the same models
+static double randomNumber(unsigned int & seed)
+{
+  seed = 1664525 * seed + 1013904223;
+  return static_cast<double> (seed >> 8) / 16777216.0;
+}
+
+// Knapsack - maximize value (as minimize -value) within capacity
+static OsiSolverInterface * knapsack(int numberItems, unsigned int & seed)
+{
+  std::vector<double> weight(numberItems), value(numberItems);
+  double totalWeight = 0.0;
+  for (int i = 0; i < numberItems; i++) {
+    weight[i] = floor(10.0 + 90.0 * randomNumber(seed));
+    value[i] = -floor(weight[i] + 20.0 * randomNumber(seed));
+    totalWeight += weight[i];
+  }
+  std::vector<int> row(numberItems, 0);
+  std::vector<CoinBigIndex> start(numberItems + 1);
+  for (int i = 0; i <= numberItems; i++)
+    start[i] = i;
+  std::vector<double> lower(numberItems, 0.0), upper(numberItems, 1.0);
+  double rowLower = -COIN_DBL_MAX;
+  double rowUpper = floor(0.5 * totalWeight);
+  OsiClpSolverInterface * solver = new OsiClpSolverInterface();
+  solver->loadProblem(numberItems, 1, &start[0], &row[0], &weight[0],
+                      &lower[0], &upper[0], &value[0], &rowLower, &rowUpper);
+  for (int i = 0; i < numberItems; i++)
+    solver->setInteger(i);
+  return solver;
+}
+
+// Assignment - n people to n jobs at least cost
+static OsiSolverInterface * assignment(int n, unsigned int & seed)
+{
+  int numberColumns = n * n;
+  std::vector<double> element(2 * numberColumns, 1.0), cost(numberColumns);
+  std::vector<int> row(2 * numberColumns);
+  std::vector<CoinBigIndex> start(numberColumns + 1);
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      int iColumn = i * n + j;
+      start[iColumn] = 2 * iColumn;
+      row[2*iColumn] = i;
+      row[2*iColumn+1] = n + j;
+      cost[iColumn] = floor(1.0 + 99.0 * randomNumber(seed));
+    }
+  }
+  start[numberColumns] = 2 * numberColumns;
+  std::vector<double> lower(numberColumns, 0.0), upper(numberColumns, 1.0);
+  std::vector<double> rowBound(2 * n, 1.0);
+  OsiClpSolverInterface * solver = new OsiClpSolverInterface();
+  solver->loadProblem(numberColumns, 2 * n, &start[0], &row[0], &element[0],
+                      &lower[0], &upper[0], &cost[0], &rowBound[0], &rowBound[0]);
+  for (int i = 0; i < numberColumns; i++)
+    solver->setInteger(i);
+  return solver;
+}
+
+// Models alternate knapsack and assignment
+static void makeModels(int numberModels, std::vector<CbcModel *> & models)
+{
+  unsigned int seed = 12345;
+  for (int i = 0; i < numberModels; i++) {
+    OsiSolverInterface * solver = (i & 1) ?
+      assignment(8 + i % 5, seed) : knapsack(30 + i % 20, seed);
+    models[i] = new CbcModel(*solver);
+    delete solver;
+  }
+}
+
+static void deleteModels(std::vector<CbcModel *> & models)
+{
+  for (size_t i = 0; i < models.size(); i++) {
+    delete models[i];
+    models[i] = NULL;
+  }
+}
+
+int main (int argc, const char *argv[])
+{
+  int numberModels = (argc > 1) ? atoi(argv[1]) : 1000;
+  int numberThreads = (argc > 2) ? atoi(argv[2]) : 4;
+  std::vector<const char *> arguments;
+  for (int i = 3; i < argc; i++)
+    arguments.push_back(argv[i]);
+  std::vector<CbcModel *> models(numberModels);
+  std::vector<double> objective(numberModels);
+
+  // One at a time as through C interface
+  makeModels(numberModels, models);
+  double time1 = CoinGetTimeOfDay();
+  for (int i = 0; i < numberModels; i++) {
+    std::vector<const char *> argv2;
+    argv2.push_back("batch");
+    argv2.insert(argv2.end(), arguments.begin(), arguments.end());
+    argv2.push_back("-log");
+    argv2.push_back("0");
+    argv2.push_back("-solve");
+    argv2.push_back("-quit");
+    models[i]->messageHandler()->setLogLevel(0);
+    CbcMain0(*models[i]);
+    CbcMain1(static_cast<int> (argv2.size()), &argv2[0], *models[i]);
+    objective[i] = models[i]->getObjValue();
+  }
+  double oneAtATime = CoinGetTimeOfDay() - time1;
+  deleteModels(models);
+  printf("One at a time     %d models in %.3f seconds - %.1f models per second\n",
+         numberModels, oneAtATime, numberModels / CoinMax(oneAtATime, 1.0e-6));
+
+  int nThreads[2] = {1, numberThreads};
+  int numberBad = 0;
+  for (int k = 0; k < 2; k++) {
+    if (k && numberThreads <= 1)
+      break;
+    makeModels(numberModels, models);
+    CbcBatchSolver batch;
+    if (arguments.size())
+      batch.setArguments(static_cast<int> (arguments.size()), &arguments[0]);
+    batch.setNumberThreads(nThreads[k]);
+    batch.solve(numberModels, &models[0]);
+    double maxSeconds = 0.0;
+    for (int i = 0; i < numberModels; i++) {
+      maxSeconds = CoinMax(maxSeconds, batch.seconds(i));
+      if (fabs(models[i]->getObjValue() - objective[i]) > 1.0e-6 * (1.0 + fabs(objective[i])))
+        numberBad++;
+    }
+    printf("Batch %d threads   %d models in %.3f seconds - %.1f models per second (longest model %.3f seconds)\n",
+           batch.threadsUsed(), numberModels, batch.totalSeconds(),
+           numberModels / CoinMax(batch.totalSeconds(), 1.0e-6), maxSeconds);
+    deleteModels(models);
+  }
+  if (numberBad)
+    printf("%d objectives did not agree\n", numberBad);
+  return numberBad ? 1 : 0;
+}
@@ -0,0 +1,80 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "CoinPragma.hpp"
+#include "OsiClpSolverInterface.hpp"
+#include "CbcModel.hpp"
+#include "CbcSolver.hpp"
+#include "CbcNodeTrace.hpp"
+
+//#############################################################################
+
+
+/************************************************************************
+
+This main program reads or writes node trace files (see CbcNodeTrace.hpp).
+
+traceSummary file.trace          prints tree shape, pruning, heuristics
+                                 and how busy each thread was
+traceSummary -csv file.trace     writes every event as comma separated
+                                 values
+traceSummary file.mps [threads]  solves file.mps with a trace going to
+                                 file.mps.trace and then summarizes it
+
+************************************************************************/
+
+int main (int argc, const char *argv[])
+{
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s [-csv] file.trace | file.mps [threads]\n", argv[0]);
+    return 1;
+  }
+  if (!strcmp(argv[1], "-csv")) {
+    if (argc < 3 || CbcNodeTrace::writeCsv(argv[2], stdout)) {
+      fprintf(stderr, "Unable to read trace file\n");
+      return 1;
+    }
+    return 0;
+  }
+  int returnCode = CbcNodeTrace::summarize(argv[1], stdout);
+  if (returnCode != 1) {
+    if (returnCode)
+      fprintf(stderr, "Unable to open %s\n", argv[1]);
+    return returnCode ? 1 : 0;
+  }
+  // Not a trace - solve as model
+  OsiClpSolverInterface solver1;
+  int numMpsReadErrors = solver1.readMps(argv[1], "");
+  if (numMpsReadErrors != 0) {
+    fprintf(stderr, "%d errors reading MPS file\n", numMpsReadErrors);
+    return numMpsReadErrors;
+  }
+  int numberThreads = argc > 2 ? atoi(argv[2]) : 0;
+  char traceName[1000];
+  sprintf(traceName, "%s.trace", argv[1]);
+  CbcNodeTrace * trace = new CbcNodeTrace(traceName, numberThreads);
+  if (!trace->isOpen()) {
+    fprintf(stderr, "Unable to open %s\n", traceName);
+    delete trace;
+    return 1;
+  }
+  CbcModel model(solver1);
+  // Copies of model (e.g. for branch and bound after preprocessing) share trace
+  model.setNodeTrace(trace);
+  CbcMain0(model);
+  char threads[20];
+  sprintf(threads, "%d", numberThreads);
+  const char * argv2[] = {"traceSummary", "-threads", threads, "-solve", "-quit"};
+  CbcMain1(5, argv2, model);
+  // writes anything left and closes file
+  delete trace;
+  CbcNodeTrace::summarize(traceName, stdout);
+  return 0;
+}
@@ -0,0 +1,212 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <cassert>
+#include <cfloat>
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinTime.hpp"
+#include "CbcModel.hpp"
+#include "CbcSolver.hpp"
+#include "CbcBatchSolver.hpp"
+#if defined(CBC_THREAD) && defined(CBC_THREAD_SAFE)
+#include "CbcThread.hpp"
+#define CBC_BATCH_THREADS
+#endif
+
+namespace {
+int batchCallBack(CbcModel * /*model*/, int /*whereFrom*/)
+{
+    return 0;
+}
+typedef struct {
+    CbcModel ** models;
+    int numberModels;
+    int * nextModel; // shared
+#ifdef CBC_BATCH_THREADS
+    pthread_mutex_t * mutex;
+#endif
+    int argc;
+    const char ** argv;
+    bool printing;
+    int * status;
+    double * objectiveValue;
+    double * seconds;
+} CbcBatchThreadInfo;
+/*
+  Take models until none left.  The parameter table is set up once and
+  each model resets it through CbcMain0.
+*/
+void * doBatchThread(void * voidInfo)
+{
+    CbcBatchThreadInfo * info = reinterpret_cast<CbcBatchThreadInfo *>(voidInfo);
+    CbcSolverUsefulData parameterData;
+    while (true) {
+        int iModel;
+#ifdef CBC_BATCH_THREADS
+        pthread_mutex_lock(info->mutex);
+#endif
+        iModel = (*info->nextModel)++;
+#ifdef CBC_BATCH_THREADS
+        pthread_mutex_unlock(info->mutex);
+#endif
+        if (iModel >= info->numberModels)
+            break;
+        double time1 = CoinGetTimeOfDay();
+        CbcModel * model = info->models[iModel];
+        parameterData.noPrinting_ = !info->printing;
+        parameterData.useSignalHandler_ = false;
+        CbcMain0(*model, parameterData);
+        try {
+            CbcMain1(info->argc, info->argv, *model, batchCallBack, parameterData);
+            info->status[iModel] = model->status();
+        } catch (CoinError e) {
+            info->status[iModel] = -1;
+        }
+        if (info->status[iModel] >= 0 && model->bestSolution())
+            info->objectiveValue[iModel] = model->getObjValue();
+        info->seconds[iModel] = CoinGetTimeOfDay() - time1;
+    }
+    return NULL;
+}
+}
+
+// Default Constructor
+CbcBatchSolver::CbcBatchSolver ()
+        : totalSeconds_(0.0),
+        numberThreads_(1),
+        threadsUsed_(0),
+        printing_(false)
+{
+}
+
+// Copy constructor
+CbcBatchSolver::CbcBatchSolver ( const CbcBatchSolver & rhs)
+        : arguments_(rhs.arguments_),
+        status_(rhs.status_),
+        objectiveValue_(rhs.objectiveValue_),
+        seconds_(rhs.seconds_),
+        totalSeconds_(rhs.totalSeconds_),
+        numberThreads_(rhs.numberThreads_),
+        threadsUsed_(rhs.threadsUsed_),
+        printing_(rhs.printing_)
+{
+}
+
+// Assignment operator
+CbcBatchSolver &
+CbcBatchSolver::operator=( const CbcBatchSolver & rhs)
+{
+    if (this != &rhs) {
+        arguments_ = rhs.arguments_;
+        status_ = rhs.status_;
+        objectiveValue_ = rhs.objectiveValue_;
+        seconds_ = rhs.seconds_;
+        totalSeconds_ = rhs.totalSeconds_;
+        numberThreads_ = rhs.numberThreads_;
+        threadsUsed_ = rhs.threadsUsed_;
+        printing_ = rhs.printing_;
+    }
+    return *this;
+}
+
+// Destructor
+CbcBatchSolver::~CbcBatchSolver ()
+{
+}
+
+// Set arguments
+void
+CbcBatchSolver::setArguments(int argc, const char * argv[])
+{
+    arguments_.clear();
+    for (int i = 0; i < argc; i++)
+        arguments_.push_back(argv[i]);
+}
+
+// Add one argument
+void
+CbcBatchSolver::addArgument(const char * argument)
+{
+    arguments_.push_back(argument);
+}
+
+// Solve models
+int
+CbcBatchSolver::solve(int numberModels, CbcModel ** models)
+{
+    double time1 = CoinGetTimeOfDay();
+    status_.assign(numberModels, -1);
+    objectiveValue_.assign(numberModels, COIN_DBL_MAX);
+    seconds_.assign(numberModels, 0.0);
+    threadsUsed_ = 0;
+    totalSeconds_ = 0.0;
+    if (numberModels <= 0)
+        return 0;
+    std::vector<const char *> argv;
+    argv.push_back("CbcBatchSolver");
+    if (!printing_) {
+        // arguments may override
+        argv.push_back("-log");
+        argv.push_back("0");
+    }
+    for (size_t i = 0; i < arguments_.size(); i++)
+        argv.push_back(arguments_[i].c_str());
+    argv.push_back("-solve");
+    argv.push_back("-quit");
+    int nextModel = 0;
+    int numberThreads = 1;
+#ifdef CBC_BATCH_THREADS
+    numberThreads = CoinMax(1, CoinMin(numberThreads_, numberModels));
+    pthread_mutex_t mutex;
+    pthread_mutex_init(&mutex, NULL);
+#endif
+    CbcBatchThreadInfo * threadInfo = new CbcBatchThreadInfo [numberThreads];
+    for (int i = 0; i < numberThreads; i++) {
+        threadInfo[i].models = models;
+        threadInfo[i].numberModels = numberModels;
+        threadInfo[i].nextModel = &nextModel;
+#ifdef CBC_BATCH_THREADS
+        threadInfo[i].mutex = &mutex;
+#endif
+        threadInfo[i].argc = static_cast<int> (argv.size());
+        threadInfo[i].argv = &argv[0];
+        threadInfo[i].printing = printing_;
+        threadInfo[i].status = &status_[0];
+        threadInfo[i].objectiveValue = &objectiveValue_[0];
+        threadInfo[i].seconds = &seconds_[0];
+    }
+    if (numberThreads == 1) {
+        doBatchThread(threadInfo);
+    } else {
+#ifdef CBC_BATCH_THREADS
+        Coin_pthread_t * threadId = new Coin_pthread_t [numberThreads];
+        for (int i = 0; i < numberThreads; i++)
+            pthread_create(&(threadId[i].thr), NULL, doBatchThread, threadInfo + i);
+        for (int i = 0; i < numberThreads; i++)
+            pthread_join(threadId[i].thr, NULL);
+        delete [] threadId;
+#endif
+    }
+#ifdef CBC_BATCH_THREADS
+    pthread_mutex_destroy(&mutex);
+#endif
+    delete [] threadInfo;
+    threadsUsed_ = numberThreads;
+    totalSeconds_ = CoinGetTimeOfDay() - time1;
+    int numberSolved = 0;
+    for (int i = 0; i < numberModels; i++) {
+        if (objectiveValue_[i] < COIN_DBL_MAX)
+            numberSolved++;
+    }
+    return numberSolved;
+}
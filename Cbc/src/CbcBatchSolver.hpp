@@ -0,0 +1,114 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CbcBatchSolver_H
+#define CbcBatchSolver_H
+
+#include <string>
+#include <vector>
+#include "CoinPragma.hpp"
+
+class CbcModel;
+
+/** Solves many independent models with one set of parameters.
+
+    Meant for large numbers of small models where setting things up for
+    each CbcMain1 costs about as much as the solve.  Each worker builds its
+    parameter table once and uses it (via CbcMain0 and CbcMain1) for every
+    model it is given, printing is off and no signal handler is set.
+    Models are handed to workers in order as workers become free, so one
+    long model does not hold up the rest.
+
+    Threads are only used if Cbc was built with CBC_THREAD and
+    CBC_THREAD_SAFE (otherwise CbcMain1 decodes arguments through static
+    data), else the models are solved one after another.
+
+    Status, objective and wall clock time of each model are kept; the
+    models themselves have their solutions as after CbcMain1.
+*/
+
+class CbcBatchSolver {
+
+public:
+
+    // Default Constructor
+    CbcBatchSolver ();
+
+    // Copy constructor
+    CbcBatchSolver ( const CbcBatchSolver &);
+
+    // Assignment operator
+    CbcBatchSolver & operator=( const CbcBatchSolver& rhs);
+
+    // Destructor
+    ~CbcBatchSolver ();
+
+    /** Set arguments used for every model - as for CbcMain1 but without
+        program name or "-solve" e.g. "-sec" "10" "-cuts" "off" */
+    void setArguments(int argc, const char * argv[]);
+    /// Add one argument
+    void addArgument(const char * argument);
+    /// Set number of threads (only used with CBC_THREAD and CBC_THREAD_SAFE)
+    inline void setNumberThreads(int value) {
+        numberThreads_ = value;
+    }
+    /// Number of threads
+    inline int numberThreads() const {
+        return numberThreads_;
+    }
+    /// Set printing (default off)
+    inline void setPrinting(bool yesNo) {
+        printing_ = yesNo;
+    }
+
+    /** Solve models (CbcMain0 and CbcMain1 on each).
+        Returns number of models with a solution */
+    int solve(int numberModels, CbcModel ** models);
+
+    /// Number of models in last solve
+    inline int numberModels() const {
+        return static_cast<int> (status_.size());
+    }
+    /// Status of model (as CbcModel::status, -1 not solved)
+    inline int status(int which) const {
+        return status_[which];
+    }
+    /// Objective value of model (COIN_DBL_MAX if no solution)
+    inline double objectiveValue(int which) const {
+        return objectiveValue_[which];
+    }
+    /// Wall clock seconds for model
+    inline double seconds(int which) const {
+        return seconds_[which];
+    }
+    /// Wall clock seconds for last solve
+    inline double totalSeconds() const {
+        return totalSeconds_;
+    }
+    /// Number of threads actually used in last solve
+    inline int threadsUsed() const {
+        return threadsUsed_;
+    }
+
+private:
+    /// Arguments
+    std::vector<std::string> arguments_;
+    /// Status of each model
+    std::vector<int> status_;
+    /// Objective of each model
+    std::vector<double> objectiveValue_;
+    /// Wall clock time of each model
+    std::vector<double> seconds_;
+    /// Wall clock time of last solve
+    double totalSeconds_;
+    /// Number of threads wanted
+    int numberThreads_;
+    /// Number of threads used
+    int threadsUsed_;
+    /// Printing
+    bool printing_;
+};
+
+#endif
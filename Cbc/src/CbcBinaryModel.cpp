@@ -0,0 +1,364 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#ifndef _MSC_VER
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinTypes.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CbcBorrowedMatrix.hpp"
+#include "CbcBinaryModel.hpp"
+
+#define CBC_BINARY_VERSION 1
+
+namespace {
+const char binaryMagic[8] = {'C', 'B', 'C', 'B', 'I', 'N', 'M', 'D'};
+// 64 bytes
+typedef struct {
+    char magic[8];
+    int version;
+    int numberRows;
+    int numberColumns;
+    int objectiveSense;
+    CoinInt64 numberElements;
+    CoinInt64 numberNames;
+    CoinInt64 nameBytes;
+    double objectiveOffset;
+    CoinInt64 fileSize;
+} CbcBinaryHeader;
+// Where each array starts (in bytes)
+typedef struct {
+    CoinInt64 start;
+    CoinInt64 element;
+    CoinInt64 columnLower;
+    CoinInt64 columnUpper;
+    CoinInt64 objective;
+    CoinInt64 rowLower;
+    CoinInt64 rowUpper;
+    CoinInt64 index;
+    CoinInt64 integer;
+    CoinInt64 nameOffset;
+    CoinInt64 names;
+    CoinInt64 end;
+} CbcBinaryOffsets;
+inline CoinInt64 roundUp8(CoinInt64 value)
+{
+    return (value + 7) & ~static_cast<CoinInt64> (7);
+}
+void computeOffsets(const CbcBinaryHeader & header, CbcBinaryOffsets & offsets)
+{
+    CoinInt64 numberColumns = header.numberColumns;
+    CoinInt64 numberRows = header.numberRows;
+    CoinInt64 numberElements = header.numberElements;
+    offsets.start = sizeof(CbcBinaryHeader);
+    offsets.element = offsets.start + (numberColumns + 1) * sizeof(CoinInt64);
+    offsets.columnLower = offsets.element + numberElements * sizeof(double);
+    offsets.columnUpper = offsets.columnLower + numberColumns * sizeof(double);
+    offsets.objective = offsets.columnUpper + numberColumns * sizeof(double);
+    offsets.rowLower = offsets.objective + numberColumns * sizeof(double);
+    offsets.rowUpper = offsets.rowLower + numberRows * sizeof(double);
+    offsets.index = offsets.rowUpper + numberRows * sizeof(double);
+    offsets.integer = roundUp8(offsets.index + numberElements * sizeof(int));
+    offsets.nameOffset = roundUp8(offsets.integer + numberColumns);
+    offsets.names = offsets.nameOffset +
+                    (header.numberNames ? (header.numberNames + 1) * sizeof(CoinInt64) : 0);
+    offsets.end = offsets.names + header.nameBytes;
+}
+// Pad file to multiple of 8 bytes - returns false on error
+bool padTo8(FILE * fp, CoinInt64 & position)
+{
+    static const char zero[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+    CoinInt64 newPosition = roundUp8(position);
+    size_t n = static_cast<size_t> (newPosition - position);
+    position = newPosition;
+    return !n || fwrite(zero, 1, n, fp) == n;
+}
+}
+
+// Write binary model
+int
+writeBinaryModel(const OsiSolverInterface * solver, const char * fileName,
+                 bool names)
+{
+    int numberRows = solver->getNumRows();
+    int numberColumns = solver->getNumCols();
+    const CoinPackedMatrix * matrix = solver->getMatrixByCol();
+    const CoinBigIndex * columnStart = matrix->getVectorStarts();
+    const int * columnLength = matrix->getVectorLengths();
+    const int * row = matrix->getIndices();
+    const double * element = matrix->getElements();
+    CbcBinaryHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, binaryMagic, sizeof(binaryMagic));
+    header.version = CBC_BINARY_VERSION;
+    header.numberRows = numberRows;
+    header.numberColumns = numberColumns;
+    header.objectiveSense = (solver->getObjSense() < 0.0) ? -1 : 1;
+    CoinInt64 numberElements = 0;
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+        numberElements += columnLength[iColumn];
+    header.numberElements = numberElements;
+    std::vector<std::string> nameList;
+    if (names) {
+        std::string problemName;
+        solver->getStrParam(OsiProbName, problemName);
+        nameList.reserve(1 + numberRows + numberColumns);
+        nameList.push_back(problemName);
+        for (int iRow = 0; iRow < numberRows; iRow++)
+            nameList.push_back(solver->getRowName(iRow));
+        for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+            nameList.push_back(solver->getColName(iColumn));
+        header.numberNames = static_cast<CoinInt64> (nameList.size());
+        for (size_t i = 0; i < nameList.size(); i++)
+            header.nameBytes += static_cast<CoinInt64> (nameList[i].size());
+    }
+    double offset = 0.0;
+    solver->getDblParam(OsiObjOffset, offset);
+    header.objectiveOffset = offset;
+    CbcBinaryOffsets offsets;
+    computeOffsets(header, offsets);
+    header.fileSize = offsets.end;
+    FILE * fp = fopen(fileName, "wb");
+    if (!fp)
+        return 1;
+    bool good = fwrite(&header, sizeof(header), 1, fp) == 1;
+    CoinInt64 position = sizeof(header);
+    // starts without gaps
+    CoinInt64 start = 0;
+    for (int iColumn = 0; iColumn <= numberColumns && good; iColumn++) {
+        good = fwrite(&start, sizeof(CoinInt64), 1, fp) == 1;
+        if (iColumn < numberColumns)
+            start += columnLength[iColumn];
+    }
+    for (int iColumn = 0; iColumn < numberColumns && good; iColumn++) {
+        size_t n = columnLength[iColumn];
+        good = !n || fwrite(element + columnStart[iColumn], sizeof(double), n, fp) == n;
+    }
+    const double * arrays[5] = {solver->getColLower(), solver->getColUpper(),
+                                solver->getObjCoefficients(),
+                                solver->getRowLower(), solver->getRowUpper()
+                               };
+    int length[5] = {numberColumns, numberColumns, numberColumns,
+                     numberRows, numberRows
+                    };
+    for (int k = 0; k < 5 && good; k++) {
+        size_t n = length[k];
+        good = !n || fwrite(arrays[k], sizeof(double), n, fp) == n;
+    }
+    position = offsets.index;
+    for (int iColumn = 0; iColumn < numberColumns && good; iColumn++) {
+        size_t n = columnLength[iColumn];
+        good = !n || fwrite(row + columnStart[iColumn], sizeof(int), n, fp) == n;
+    }
+    position += numberElements * sizeof(int);
+    good = good && padTo8(fp, position);
+    if (good) {
+        std::vector<char> integer(numberColumns + 1);
+        for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+            integer[iColumn] = solver->isInteger(iColumn) ? 1 : 0;
+        good = fwrite(&integer[0], 1, numberColumns, fp) == static_cast<size_t> (numberColumns);
+        position += numberColumns;
+        good = good && padTo8(fp, position);
+    }
+    if (header.numberNames) {
+        CoinInt64 nameOffset = 0;
+        for (size_t i = 0; i <= nameList.size() && good; i++) {
+            good = fwrite(&nameOffset, sizeof(CoinInt64), 1, fp) == 1;
+            if (i < nameList.size())
+                nameOffset += static_cast<CoinInt64> (nameList[i].size());
+        }
+        for (size_t i = 0; i < nameList.size() && good; i++) {
+            size_t n = nameList[i].size();
+            good = !n || fwrite(nameList[i].c_str(), 1, n, fp) == n;
+        }
+    }
+    if (fclose(fp))
+        good = false;
+    return good ? 0 : 1;
+}
+
+// True if file starts like binary model
+bool
+isBinaryModel(const char * fileName)
+{
+    FILE * fp = fopen(fileName, "rb");
+    if (!fp)
+        return false;
+    char magic[8];
+    bool yes = fread(magic, 1, sizeof(magic), fp) == sizeof(magic) &&
+               !memcmp(magic, binaryMagic, sizeof(magic));
+    fclose(fp);
+    return yes;
+}
+
+// Read binary model
+int
+readBinaryModel(OsiSolverInterface * solver, const char * fileName)
+{
+    const char * data = NULL;
+    CoinInt64 fileSize = 0;
+#ifndef _MSC_VER
+    int fd = open(fileName, O_RDONLY);
+    if (fd < 0)
+        return -1;
+    struct stat statBuffer;
+    if (fstat(fd, &statBuffer) || statBuffer.st_size < static_cast<off_t> (sizeof(CbcBinaryHeader))) {
+        close(fd);
+        return 1;
+    }
+    fileSize = statBuffer.st_size;
+    void * mapped = mmap(NULL, static_cast<size_t> (fileSize), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED)
+        return 1;
+#ifdef MADV_SEQUENTIAL
+    madvise(mapped, static_cast<size_t> (fileSize), MADV_SEQUENTIAL);
+#endif
+    data = reinterpret_cast<const char *> (mapped);
+#else
+    // no mapping - read it all
+    std::vector<char> buffer;
+    FILE * fp = fopen(fileName, "rb");
+    if (!fp)
+        return -1;
+    char chunk[65536];
+    size_t nRead;
+    while ((nRead = fread(chunk, 1, sizeof(chunk), fp)) > 0)
+        buffer.insert(buffer.end(), chunk, chunk + nRead);
+    fclose(fp);
+    fileSize = static_cast<CoinInt64> (buffer.size());
+    if (fileSize < static_cast<CoinInt64> (sizeof(CbcBinaryHeader)))
+        return 1;
+    data = &buffer[0];
+#endif
+    CbcBinaryHeader header;
+    memcpy(&header, data, sizeof(header));
+    CbcBinaryOffsets offsets;
+    bool good = !memcmp(header.magic, binaryMagic, sizeof(binaryMagic)) &&
+                header.version == CBC_BINARY_VERSION &&
+                header.numberRows >= 0 && header.numberColumns >= 0 &&
+                header.numberElements >= 0 && header.numberNames >= 0 &&
+                header.nameBytes >= 0 && header.fileSize == fileSize;
+    if (good) {
+        computeOffsets(header, offsets);
+        good = offsets.end == fileSize &&
+               (!header.numberNames ||
+                header.numberNames == 1 + header.numberRows + header.numberColumns);
+    }
+    int numberRows = header.numberRows;
+    int numberColumns = header.numberColumns;
+    CoinBigIndex numberElements = static_cast<CoinBigIndex> (header.numberElements);
+    if (good && static_cast<CoinInt64> (numberElements) != header.numberElements)
+        good = false; // too big for this build
+    CoinBigIndex * start = NULL;
+    int * row = NULL;
+    double * element = NULL;
+    if (good) {
+        // check matrix as bad file should not crash solver
+        const CoinInt64 * fileStart =
+            reinterpret_cast<const CoinInt64 *> (data + offsets.start);
+        const int * fileRow = reinterpret_cast<const int *> (data + offsets.index);
+        start = new CoinBigIndex [numberColumns+1];
+        good = !fileStart[0] && fileStart[numberColumns] == header.numberElements;
+        for (int iColumn = 0; iColumn <= numberColumns && good; iColumn++) {
+            start[iColumn] = static_cast<CoinBigIndex> (fileStart[iColumn]);
+            if (iColumn && fileStart[iColumn] < fileStart[iColumn-1])
+                good = false;
+        }
+        for (CoinBigIndex j = 0; j < numberElements && good; j++) {
+            if (fileRow[j] < 0 || fileRow[j] >= numberRows)
+                good = false;
+        }
+        if (good) {
+            // one copy - solver takes these over
+            row = CoinCopyOfArray(fileRow, numberElements);
+            element = CoinCopyOfArray(reinterpret_cast<const double *> (data + offsets.element),
+                                      numberElements);
+        } else {
+            delete [] start;
+            start = NULL;
+        }
+    }
+    if (good) {
+        if (!numberElements) {
+            // CoinCopyOfArray gives NULL
+            delete [] row;
+            delete [] element;
+            row = new int [1];
+            element = new double [1];
+        }
+        const double * columnLower =
+            reinterpret_cast<const double *> (data + offsets.columnLower);
+        const double * columnUpper =
+            reinterpret_cast<const double *> (data + offsets.columnUpper);
+        const double * objective =
+            reinterpret_cast<const double *> (data + offsets.objective);
+        const double * rowLower =
+            reinterpret_cast<const double *> (data + offsets.rowLower);
+        const double * rowUpper =
+            reinterpret_cast<const double *> (data + offsets.rowUpper);
+        CbcBorrowedMatrix::loadProblem(solver, numberColumns, numberRows,
+                                       start, row, element,
+                                       columnLower, columnUpper, objective,
+                                       rowLower, rowUpper, true);
+        const char * integer = data + offsets.integer;
+        std::vector<int> which;
+        for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+            if (integer[iColumn])
+                which.push_back(iColumn);
+        }
+        if (which.size())
+            solver->setInteger(&which[0], static_cast<int> (which.size()));
+        solver->setObjSense(header.objectiveSense);
+        solver->setDblParam(OsiObjOffset, header.objectiveOffset);
+        if (header.numberNames) {
+            const CoinInt64 * nameOffset =
+                reinterpret_cast<const CoinInt64 *> (data + offsets.nameOffset);
+            const char * names = data + offsets.names;
+            bool namesGood = !nameOffset[0] &&
+                             nameOffset[header.numberNames] == header.nameBytes;
+            for (CoinInt64 i = 0; i < header.numberNames && namesGood; i++) {
+                if (nameOffset[i+1] < nameOffset[i])
+                    namesGood = false;
+            }
+            if (namesGood) {
+                solver->setStrParam(OsiProbName,
+                                    std::string(names, static_cast<size_t> (nameOffset[1])));
+                for (int iRow = 0; iRow < numberRows; iRow++) {
+                    CoinInt64 k = 1 + iRow;
+                    solver->setRowName(iRow, std::string(names + nameOffset[k],
+                                                         static_cast<size_t> (nameOffset[k+1] - nameOffset[k])));
+                }
+                for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+                    CoinInt64 k = 1 + numberRows + iColumn;
+                    solver->setColName(iColumn, std::string(names + nameOffset[k],
+                                                            static_cast<size_t> (nameOffset[k+1] - nameOffset[k])));
+                }
+            }
+        }
+    }
+#ifndef _MSC_VER
+    munmap(mapped, static_cast<size_t> (fileSize));
+#endif
+    return good ? 0 : 1;
+}
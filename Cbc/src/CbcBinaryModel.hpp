@@ -0,0 +1,45 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CbcBinaryModel_H
+#define CbcBinaryModel_H
+
+class OsiSolverInterface;
+
+/* Binary model files.
+
+   Text formats (mps, lp) take a long time to parse for big models.  A
+   binary model file is just the arrays in native byte order so reading
+   is little more than mapping the file into memory -
+
+   header (64 bytes - magic "CBCBINMD", version, rows, columns, sense,
+     elements, number of names, bytes of names, offset, file size)
+   column starts (64 bit, columns+1), elements (columns), column lower,
+     column upper, objective (columns), row lower, row upper (rows),
+     row indices (32 bit, padded to 8 bytes),
+     integer flags (one byte per column, padded to 8 bytes),
+   name offsets (64 bit, names+1) and names (not null terminated)
+     - names are problem name, row names then column names (or none).
+
+   Files are only read on a machine with the same byte order.
+*/
+
+/* writes model in solver (names if wanted) to fileName
+   returns 0 with success,
+   1 otherwise */
+int writeBinaryModel(const OsiSolverInterface * solver, const char * fileName,
+                     bool names = true);
+
+/* reads model from fileName into solver (without copying matrix
+   more than once if Clp)
+   returns 0 with success,
+   -1 if can not open,
+   1 if not a valid binary model file */
+int readBinaryModel(OsiSolverInterface * solver, const char * fileName);
+
+/* true if fileName can be opened and starts like a binary model file */
+bool isBinaryModel(const char * fileName);
+
+#endif
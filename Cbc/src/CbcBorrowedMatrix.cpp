@@ -0,0 +1,198 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <cassert>
+#ifndef _MSC_VER
+#include <sys/time.h>
+#include <sys/resource.h>
+#endif
+
+#include "CoinHelperFunctions.hpp"
+#include "OsiSolverInterface.hpp"
+#ifdef COIN_HAS_CLP
+#include "OsiClpSolverInterface.hpp"
+#include "ClpPackedMatrix.hpp"
+#endif
+#include "CbcBorrowedMatrix.hpp"
+
+// Default Constructor
+CbcBorrowedMatrix::CbcBorrowedMatrix ()
+        : CoinPackedMatrix(),
+        borrowedStart_(NULL),
+        borrowedIndex_(NULL),
+        borrowedElement_(NULL)
+{
+}
+
+// Useful constructor
+CbcBorrowedMatrix::CbcBorrowedMatrix (int numberRows, int numberColumns,
+                                      const CoinBigIndex * start, const int * index,
+                                      const double * element, bool owned)
+        : CoinPackedMatrix(),
+        borrowedStart_(owned ? NULL : start),
+        borrowedIndex_(owned ? NULL : index),
+        borrowedElement_(owned ? NULL : element)
+{
+    assert (!start[0]);
+    int * length = new int [numberColumns];
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+        length[iColumn] = static_cast<int> (start[iColumn+1] - start[iColumn]);
+    // assignMatrix takes over (and NULLs) these
+    CoinBigIndex * useStart = const_cast<CoinBigIndex *> (start);
+    int * useIndex = const_cast<int *> (index);
+    double * useElement = const_cast<double *> (element);
+    assignMatrix(true, numberRows, numberColumns, start[numberColumns],
+                 useElement, useIndex, useStart, length);
+}
+
+// Copy constructor
+CbcBorrowedMatrix::CbcBorrowedMatrix ( const CbcBorrowedMatrix & rhs)
+        : CoinPackedMatrix(rhs),
+        borrowedStart_(NULL),
+        borrowedIndex_(NULL),
+        borrowedElement_(NULL)
+{
+}
+
+// Assignment operator
+CbcBorrowedMatrix &
+CbcBorrowedMatrix::operator=( const CbcBorrowedMatrix & rhs)
+{
+    if (this != &rhs) {
+        release();
+        CoinPackedMatrix::operator=(rhs);
+    }
+    return *this;
+}
+
+// Destructor
+CbcBorrowedMatrix::~CbcBorrowedMatrix ()
+{
+    release();
+}
+
+// True if any arrays are still the caller's
+bool
+CbcBorrowedMatrix::borrowing() const
+{
+    return (borrowedStart_ && start_ == borrowedStart_) ||
+           (borrowedIndex_ && index_ == borrowedIndex_) ||
+           (borrowedElement_ && element_ == borrowedElement_);
+}
+
+// Forget caller's arrays so base class does not free them
+void
+CbcBorrowedMatrix::release()
+{
+    if (borrowedStart_ && start_ == borrowedStart_)
+        start_ = NULL;
+    if (borrowedIndex_ && index_ == borrowedIndex_)
+        index_ = NULL;
+    if (borrowedElement_ && element_ == borrowedElement_)
+        element_ = NULL;
+    borrowedStart_ = NULL;
+    borrowedIndex_ = NULL;
+    borrowedElement_ = NULL;
+}
+
+// Load problem without copying matrix
+bool
+CbcBorrowedMatrix::loadProblem(OsiSolverInterface * solver,
+                               int numberColumns, int numberRows,
+                               const CoinBigIndex * start, const int * index,
+                               const double * element,
+                               const double * columnLower, const double * columnUpper,
+                               const double * objective,
+                               const double * rowLower, const double * rowUpper,
+                               bool owned)
+{
+#ifdef COIN_HAS_CLP
+    OsiClpSolverInterface * clpSolver
+    = dynamic_cast<OsiClpSolverInterface *> (solver);
+    if (clpSolver) {
+        // everything but matrix in normal way
+        CoinPackedMatrix empty;
+        empty.setDimensions(numberRows, numberColumns);
+        solver->loadProblem(empty, columnLower, columnUpper, objective,
+                            rowLower, rowUpper);
+        CbcBorrowedMatrix * matrix =
+            new CbcBorrowedMatrix(numberRows, numberColumns, start, index,
+                                  element, owned);
+        // ClpPackedMatrix takes over matrix and Clp the ClpPackedMatrix
+        clpSolver->getModelPtr()->replaceMatrix(new ClpPackedMatrix(matrix), true);
+        return true;
+    }
+#endif
+    solver->loadProblem(numberColumns, numberRows, start, index, element,
+                        columnLower, columnUpper, objective, rowLower, rowUpper);
+    if (owned) {
+        delete [] start;
+        delete [] index;
+        delete [] element;
+    }
+    return false;
+}
+
+// Assign problem without copying matrix
+bool
+CbcBorrowedMatrix::assignProblem(OsiSolverInterface * solver,
+                                 CoinPackedMatrix *& matrix,
+                                 double *& columnLower, double *& columnUpper,
+                                 double *& objective,
+                                 double *& rowLower, double *& rowUpper)
+{
+#ifdef COIN_HAS_CLP
+    OsiClpSolverInterface * clpSolver
+    = dynamic_cast<OsiClpSolverInterface *> (solver);
+    if (clpSolver && matrix->isColOrdered()) {
+        CoinPackedMatrix empty;
+        empty.setDimensions(matrix->getNumRows(), matrix->getNumCols());
+        solver->loadProblem(empty, columnLower, columnUpper, objective,
+                            rowLower, rowUpper);
+        clpSolver->getModelPtr()->replaceMatrix(new ClpPackedMatrix(matrix), true);
+        matrix = NULL;
+        delete [] columnLower;
+        columnLower = NULL;
+        delete [] columnUpper;
+        columnUpper = NULL;
+        delete [] objective;
+        objective = NULL;
+        delete [] rowLower;
+        rowLower = NULL;
+        delete [] rowUpper;
+        rowUpper = NULL;
+        return true;
+    }
+#endif
+    solver->assignProblem(matrix, columnLower, columnUpper, objective,
+                          rowLower, rowUpper);
+    return false;
+}
+
+// Peak resident memory in megabytes
+double
+CbcBorrowedMatrix::peakMemory()
+{
+#ifndef _MSC_VER
+    struct rusage usage;
+    if (!getrusage(RUSAGE_SELF, &usage)) {
+#ifdef __APPLE__
+        // bytes
+        return static_cast<double> (usage.ru_maxrss) / (1024.0 * 1024.0);
+#else
+        // kilobytes
+        return static_cast<double> (usage.ru_maxrss) / 1024.0;
+#endif
+    }
+#endif
+    return 0.0;
+}
@@ -0,0 +1,96 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CbcBorrowedMatrix_H
+#define CbcBorrowedMatrix_H
+
+#include "CoinPragma.hpp"
+#include "CoinPackedMatrix.hpp"
+
+class OsiSolverInterface;
+
+/** Column ordered matrix (without gaps) which uses the caller's arrays.
+
+    Loading a model normally copies start, index and element arrays into a
+    CoinPackedMatrix and then again into the solver, so for a big model
+    peak memory is about three times the matrix.  This matrix is given
+    to Clp as is (ClpPackedMatrix takes over a CoinPackedMatrix without
+    copying) so the solver works on the caller's arrays.
+
+    Lifetime contract -
+    - borrowed (owned false) - the arrays must stay valid and must not be
+      changed by the caller until the solver is deleted or a new problem
+      is loaded into it.  They are never freed here.  Copies of the solver
+      (CbcModel, preprocessing, cuts all work on copies) have their own
+      matrix, so a copy is only made when something needs to change it.
+      Changing coefficients or adding or deleting rows or columns in the
+      solver itself is not allowed while borrowing.
+    - owned - the arrays must have come from new [] and belong to the
+      matrix from now on.
+
+    Only the column lengths (one int per column) are allocated here.  If
+    the solver is not Clp the problem is loaded in the normal way.
+*/
+
+class CbcBorrowedMatrix : public CoinPackedMatrix {
+
+public:
+
+    // Default Constructor
+    CbcBorrowedMatrix ();
+
+    /** Useful constructor - column ordered without gaps
+        (start has numberColumns+1 entries, start[0] zero) */
+    CbcBorrowedMatrix (int numberRows, int numberColumns,
+                       const CoinBigIndex * start, const int * index,
+                       const double * element, bool owned = false);
+
+    /// Copy constructor - the copy owns its arrays
+    CbcBorrowedMatrix ( const CbcBorrowedMatrix &);
+
+    /// Assignment operator - this owns its arrays
+    CbcBorrowedMatrix & operator=( const CbcBorrowedMatrix& rhs);
+
+    /// Destructor - caller's arrays are left alone
+    virtual ~CbcBorrowedMatrix ();
+
+    /// True if any arrays are still the caller's
+    bool borrowing() const;
+
+    /** Load problem into solver without copying matrix (see class
+        comment for lifetime).  Bounds and objective are copied.
+        Returns true if matrix was not copied */
+    static bool loadProblem(OsiSolverInterface * solver,
+                            int numberColumns, int numberRows,
+                            const CoinBigIndex * start, const int * index,
+                            const double * element,
+                            const double * columnLower, const double * columnUpper,
+                            const double * objective,
+                            const double * rowLower, const double * rowUpper,
+                            bool owned = false);
+    /** As OsiSolverInterface::assignProblem but a column ordered matrix
+        is taken over by Clp without being copied.
+        Returns true if matrix was not copied */
+    static bool assignProblem(OsiSolverInterface * solver,
+                              CoinPackedMatrix *& matrix,
+                              double *& columnLower, double *& columnUpper,
+                              double *& objective,
+                              double *& rowLower, double *& rowUpper);
+    /// Peak resident memory of process in megabytes (0.0 if not known)
+    static double peakMemory();
+
+private:
+    /// Forget caller's arrays so they are not freed
+    void release();
+
+    /// Caller's starts (NULL if owned)
+    const CoinBigIndex * borrowedStart_;
+    /// Caller's indices (NULL if owned)
+    const int * borrowedIndex_;
+    /// Caller's elements (NULL if owned)
+    const double * borrowedElement_;
+};
+
+#endif
@@ -0,0 +1,30 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CbcClpUnitTest_H
+#define CbcClpUnitTest_H
+
+#include <string>
+
+class CbcModel;
+
+/* Unit test and benchmark entry points (in unitTestClp.cpp).
+   See unitTestClp.cpp for the problem lists and file formats. */
+
+/** Solve miplib problems (testSwitch -2 just the unit test problems)
+    with copies of saveModel.  Returns 0 if all goes well, otherwise
+    100*(number with bad objective)+(number that exceeded node limit) */
+int CbcClpUnitTest (const CbcModel & saveModel,
+                    const std::string & dirMiplib, int testSwitch,
+                    const double * stuff);
+/** Run benchmark file writing results to resultsFile.  Returns -1 if a
+    file can not be opened, otherwise number of wrong or failed runs */
+int CbcClpBenchmark (const std::string & dirMiplib, const char * benchmarkFile,
+                     const char * resultsFile);
+/** Compare two benchmark results files.  Returns -1 if a file can not be
+    read, 1 if newFile is significantly worse, otherwise 0 */
+int CbcClpBenchmarkCompare (const char * baseFile, const char * newFile);
+
+#endif
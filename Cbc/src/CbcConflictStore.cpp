@@ -0,0 +1,307 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <cassert>
+#include <cmath>
+#include <cfloat>
+#include <algorithm>
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinTime.hpp"
+#include "CoinFinite.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CbcConflictStore.hpp"
+
+// Activities are rescaled when increment gets this large
+#define CBC_CONFLICT_RESCALE 1.0e20
+
+// Default Constructor
+CbcConflictStore::CbcConflictStore ()
+        : numberColumns_(0),
+        maximumConflicts_(10000),
+        maximumLength_(20),
+        activityIncrement_(1.0),
+        stamp_(0),
+        numberLearned_(0),
+        numberDeleted_(0),
+        numberPruned_(0),
+        timeInConflicts_(0.0),
+        learnFromNodes_(true)
+{
+    start_.push_back(0);
+}
+
+// Copy constructor
+CbcConflictStore::CbcConflictStore ( const CbcConflictStore & rhs)
+        : numberColumns_(rhs.numberColumns_),
+        maximumConflicts_(rhs.maximumConflicts_),
+        maximumLength_(rhs.maximumLength_),
+        rootLower_(rhs.rootLower_),
+        rootUpper_(rhs.rootUpper_),
+        start_(rhs.start_),
+        column_(rhs.column_),
+        bound_(rhs.bound_),
+        isUpper_(rhs.isUpper_),
+        activity_(rhs.activity_),
+        checked_(rhs.checked_),
+        occurrence_(rhs.occurrence_),
+        activityIncrement_(rhs.activityIncrement_),
+        stamp_(rhs.stamp_),
+        numberLearned_(rhs.numberLearned_),
+        numberDeleted_(rhs.numberDeleted_),
+        numberPruned_(rhs.numberPruned_),
+        timeInConflicts_(rhs.timeInConflicts_),
+        learnFromNodes_(rhs.learnFromNodes_)
+{
+}
+
+// Assignment operator
+CbcConflictStore &
+CbcConflictStore::operator=( const CbcConflictStore & rhs)
+{
+    if (this != &rhs) {
+        numberColumns_ = rhs.numberColumns_;
+        maximumConflicts_ = rhs.maximumConflicts_;
+        maximumLength_ = rhs.maximumLength_;
+        rootLower_ = rhs.rootLower_;
+        rootUpper_ = rhs.rootUpper_;
+        start_ = rhs.start_;
+        column_ = rhs.column_;
+        bound_ = rhs.bound_;
+        isUpper_ = rhs.isUpper_;
+        activity_ = rhs.activity_;
+        checked_ = rhs.checked_;
+        occurrence_ = rhs.occurrence_;
+        activityIncrement_ = rhs.activityIncrement_;
+        stamp_ = rhs.stamp_;
+        numberLearned_ = rhs.numberLearned_;
+        numberDeleted_ = rhs.numberDeleted_;
+        numberPruned_ = rhs.numberPruned_;
+        timeInConflicts_ = rhs.timeInConflicts_;
+        learnFromNodes_ = rhs.learnFromNodes_;
+    }
+    return *this;
+}
+
+// Destructor
+CbcConflictStore::~CbcConflictStore ()
+{
+}
+
+// Set up from solver
+void
+CbcConflictStore::initialize(const OsiSolverInterface * solver,
+                             int maximumConflicts, int maximumLength)
+{
+    numberColumns_ = solver->getNumCols();
+    maximumConflicts_ = CoinMax(maximumConflicts, 2);
+    maximumLength_ = CoinMax(maximumLength, 1);
+    const double * lower = solver->getColLower();
+    const double * upper = solver->getColUpper();
+    rootLower_.assign(lower, lower + numberColumns_);
+    rootUpper_.assign(upper, upper + numberColumns_);
+    start_.assign(1, 0);
+    column_.clear();
+    bound_.clear();
+    isUpper_.clear();
+    activity_.clear();
+    checked_.clear();
+    occurrence_.assign(numberColumns_, std::vector<int>());
+    activityIncrement_ = 1.0;
+    stamp_ = 0;
+}
+
+// Add a conflict
+int
+CbcConflictStore::addConflict(int numberLiterals, const int * column,
+                              const double * bound, const char * isUpper)
+{
+    if (numberLiterals <= 0 || numberLiterals > maximumLength_ || !numberColumns_)
+        return -1;
+    if (static_cast<int> (activity_.size()) >= maximumConflicts_)
+        reduce();
+    int iConflict = static_cast<int> (activity_.size());
+    for (int i = 0; i < numberLiterals; i++) {
+        int iColumn = column[i];
+        assert (iColumn >= 0 && iColumn < numberColumns_);
+        column_.push_back(iColumn);
+        bound_.push_back(bound[i]);
+        isUpper_.push_back(isUpper[i] ? 1 : 0);
+        occurrence_[iColumn].push_back(iConflict);
+    }
+    start_.push_back(static_cast<int> (column_.size()));
+    activity_.push_back(activityIncrement_);
+    checked_.push_back(0);
+    numberLearned_++;
+    // later conflicts count for more (activities decay)
+    activityIncrement_ *= 1.0 / 0.95;
+    if (activityIncrement_ > CBC_CONFLICT_RESCALE) {
+        for (size_t i = 0; i < activity_.size(); i++)
+            activity_[i] /= CBC_CONFLICT_RESCALE;
+        activityIncrement_ /= CBC_CONFLICT_RESCALE;
+    }
+    return iConflict;
+}
+
+// Add a conflict from column bounds in solver
+int
+CbcConflictStore::addNodeConflict(const OsiSolverInterface * solver)
+{
+    if (!numberColumns_ || !learnFromNodes_)
+        return -1;
+    double time1 = CoinCpuTime();
+    const double * lower = solver->getColLower();
+    const double * upper = solver->getColUpper();
+    int * column = new int [maximumLength_];
+    double * bound = new double [maximumLength_];
+    char * isUpper = new char [maximumLength_];
+    int numberLiterals = 0;
+    /*
+      Continuous bounds are needed as well - local cuts (and so the LP)
+      at the node may depend on them.
+    */
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+        if (lower[iColumn] > rootLower_[iColumn]) {
+            if (numberLiterals == maximumLength_) {
+                numberLiterals = -1;
+                break;
+            }
+            column[numberLiterals] = iColumn;
+            bound[numberLiterals] = lower[iColumn];
+            isUpper[numberLiterals++] = 0;
+        }
+        if (upper[iColumn] < rootUpper_[iColumn]) {
+            if (numberLiterals == maximumLength_) {
+                numberLiterals = -1;
+                break;
+            }
+            column[numberLiterals] = iColumn;
+            bound[numberLiterals] = upper[iColumn];
+            isUpper[numberLiterals++] = 1;
+        }
+    }
+    int iConflict = addConflict(numberLiterals, column, bound, isUpper);
+    delete [] column;
+    delete [] bound;
+    delete [] isUpper;
+    timeInConflicts_ += CoinCpuTime() - time1;
+    return iConflict;
+}
+
+// See if any conflict holds
+bool
+CbcConflictStore::prune(const double * lower, const double * upper,
+                        const double * lowerBefore, const double * upperBefore)
+{
+    if (activity_.empty())
+        return false;
+    double time1 = CoinCpuTime();
+    if (stamp_ == COIN_INT_MAX) {
+        std::fill(checked_.begin(), checked_.end(), 0);
+        stamp_ = 0;
+    }
+    stamp_++;
+    bool pruned = false;
+    /*
+      Any conflict which holds now but did not at parent must contain a
+      column changed by this branch (or propagation after it).
+    */
+    for (int iColumn = 0; iColumn < numberColumns_ && !pruned; iColumn++) {
+        if (lower[iColumn] == lowerBefore[iColumn] &&
+                upper[iColumn] == upperBefore[iColumn])
+            continue;
+        const std::vector<int> & list = occurrence_[iColumn];
+        for (size_t k = 0; k < list.size(); k++) {
+            int iConflict = list[k];
+            if (checked_[iConflict] == stamp_)
+                continue;
+            checked_[iConflict] = stamp_;
+            bool holds = true;
+            for (int j = start_[iConflict]; j < start_[iConflict+1]; j++) {
+                int jColumn = column_[j];
+                if (isUpper_[j]) {
+                    if (upper[jColumn] > bound_[j] + 1.0e-9) {
+                        holds = false;
+                        break;
+                    }
+                } else {
+                    if (lower[jColumn] < bound_[j] - 1.0e-9) {
+                        holds = false;
+                        break;
+                    }
+                }
+            }
+            if (holds) {
+                activity_[iConflict] += activityIncrement_;
+                numberPruned_++;
+                pruned = true;
+                break;
+            }
+        }
+    }
+    timeInConflicts_ += CoinCpuTime() - time1;
+    return pruned;
+}
+
+// Delete less active half of conflicts and rebuild lists
+void
+CbcConflictStore::reduce()
+{
+    int numberConflicts = static_cast<int> (activity_.size());
+    int numberKeep = numberConflicts / 2;
+    // find activity of conflict numberKeep from top
+    std::vector<double> sorted(activity_);
+    std::nth_element(sorted.begin(), sorted.begin() + (numberConflicts - numberKeep),
+                     sorted.end());
+    double threshold = sorted[numberConflicts - numberKeep];
+    std::vector<int> newStart(1, 0);
+    std::vector<double> newActivity;
+    int put = 0;
+    for (int iConflict = 0; iConflict < numberConflicts; iConflict++) {
+        // ties may let a few more through - stop at numberKeep
+        if (activity_[iConflict] < threshold ||
+                static_cast<int> (newActivity.size()) == numberKeep)
+            continue;
+        for (int j = start_[iConflict]; j < start_[iConflict+1]; j++) {
+            column_[put] = column_[j];
+            bound_[put] = bound_[j];
+            isUpper_[put++] = isUpper_[j];
+        }
+        newStart.push_back(put);
+        newActivity.push_back(activity_[iConflict]);
+    }
+    column_.resize(put);
+    bound_.resize(put);
+    isUpper_.resize(put);
+    start_.swap(newStart);
+    activity_.swap(newActivity);
+    numberDeleted_ += numberConflicts - static_cast<int> (activity_.size());
+    checked_.assign(activity_.size(), 0);
+    stamp_ = 0;
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++)
+        occurrence_[iColumn].clear();
+    numberConflicts = static_cast<int> (activity_.size());
+    for (int iConflict = 0; iConflict < numberConflicts; iConflict++) {
+        for (int j = start_[iConflict]; j < start_[iConflict+1]; j++)
+            occurrence_[column_[j]].push_back(iConflict);
+    }
+}
+
+// Add in statistics from another copy
+void
+CbcConflictStore::addStatistics(const CbcConflictStore & rhs)
+{
+    numberLearned_ += rhs.numberLearned_;
+    numberDeleted_ += rhs.numberDeleted_;
+    numberPruned_ += rhs.numberPruned_;
+    timeInConflicts_ += rhs.timeInConflicts_;
+}
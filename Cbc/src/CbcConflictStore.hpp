@@ -0,0 +1,156 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CbcConflictStore_H
+#define CbcConflictStore_H
+
+#include <vector>
+#include "CoinPragma.hpp"
+
+class OsiSolverInterface;
+
+/** Store of learned conflicts used to prune nodes before the LP.
+
+    A conflict is a short set of bound literals (column <= value or
+    column >= value) which can not all hold in any solution better than
+    the cutoff.  Conflicts come from rows found infeasible by node
+    propagation (see CbcPropagation::conflict) and from nodes which the LP
+    found infeasible or cut off, when the bounds changed from the root
+    are few enough.  As the cutoff only goes down they stay valid.
+    Node conflicts are only sound if branching is just bound changes on
+    integers, so CbcModel only learns them when all objects are simple
+    integers (see setLearnFromNodes).  They record continuous bounds as
+    well as integer ones since local cuts depend on both.
+
+    After branching, conflicts containing a column whose bounds changed are
+    checked and if all literals of one hold the node is pruned.  Each
+    conflict has an activity which is bumped when it is learned or prunes
+    a node; when the store is full the less active half is deleted.
+*/
+
+class CbcConflictStore {
+
+public:
+
+    // Default Constructor
+    CbcConflictStore ();
+
+    // Copy constructor
+    CbcConflictStore ( const CbcConflictStore &);
+
+    // Assignment operator
+    CbcConflictStore & operator=( const CbcConflictStore& rhs);
+
+    // Destructor
+    ~CbcConflictStore ();
+
+    /** Set up from solver - normally continuous solver.
+        Literals are only needed for bounds tighter than these.
+        maximumConflicts is size of store, maximumLength longest conflict kept.
+    */
+    void initialize(const OsiSolverInterface * solver,
+                    int maximumConflicts = 10000, int maximumLength = 20);
+
+    /** Add a conflict.  Literal i is column[i] <= bound[i] if isUpper[i]
+        nonzero, otherwise column[i] >= bound[i].
+        Returns index of conflict or -1 if not added.
+    */
+    int addConflict(int numberLiterals, const int * column,
+                    const double * bound, const char * isUpper);
+
+    /** Add a conflict from all column bounds in solver which are
+        tighter than at initialize (node infeasible or cut off).
+        Returns index of conflict or -1 if too long or not learning
+        from nodes.
+    */
+    int addNodeConflict(const OsiSolverInterface * solver);
+
+    /** Check conflicts containing a column whose bounds differ from
+        lowerBefore/upperBefore.  Returns true if one holds (prune node).
+    */
+    bool prune(const double * lower, const double * upper,
+               const double * lowerBefore, const double * upperBefore);
+
+    /// Add in statistics from another copy (e.g. a thread)
+    void addStatistics(const CbcConflictStore & rhs);
+
+    /// Set whether conflicts are learned from infeasible nodes
+    inline void setLearnFromNodes(bool yesNo) {
+        learnFromNodes_ = yesNo;
+    }
+    /// Whether conflicts are learned from infeasible nodes
+    inline bool learnFromNodes() const {
+        return learnFromNodes_;
+    }
+    /// Maximum number of literals in a conflict
+    inline int maximumLength() const {
+        return maximumLength_;
+    }
+    /// Number of conflicts in store
+    inline int numberConflicts() const {
+        return static_cast<int> (activity_.size());
+    }
+    /// Number of conflicts learned
+    inline int numberLearned() const {
+        return numberLearned_;
+    }
+    /// Number of conflicts deleted
+    inline int numberDeleted() const {
+        return numberDeleted_;
+    }
+    /// Number of nodes pruned by conflicts
+    inline int numberPruned() const {
+        return numberPruned_;
+    }
+    /// Time spent checking and learning
+    inline double timeInConflicts() const {
+        return timeInConflicts_;
+    }
+
+private:
+    /// Delete less active half of conflicts and rebuild lists
+    void reduce();
+
+    /// Number of columns
+    int numberColumns_;
+    /// Maximum number of conflicts
+    int maximumConflicts_;
+    /// Maximum number of literals in a conflict
+    int maximumLength_;
+    /// Column lower bounds at initialize
+    std::vector<double> rootLower_;
+    /// Column upper bounds at initialize
+    std::vector<double> rootUpper_;
+    /// Start of each conflict in literal arrays (size numberConflicts+1)
+    std::vector<int> start_;
+    /// Column of literal
+    std::vector<int> column_;
+    /// Bound of literal
+    std::vector<double> bound_;
+    /// Nonzero if literal is upper bound
+    std::vector<char> isUpper_;
+    /// Activity of conflict
+    std::vector<double> activity_;
+    /// Stamp when conflict last checked (work)
+    std::vector<int> checked_;
+    /// Conflicts each column is in
+    std::vector< std::vector<int> > occurrence_;
+    /// Amount to bump activity by
+    double activityIncrement_;
+    /// Current stamp
+    int stamp_;
+    /// Number of conflicts learned
+    int numberLearned_;
+    /// Number of conflicts deleted
+    int numberDeleted_;
+    /// Number of nodes pruned
+    int numberPruned_;
+    /// Time in conflicts
+    double timeInConflicts_;
+    /// Whether conflicts are learned from infeasible nodes
+    bool learnFromNodes_;
+};
+
+#endif
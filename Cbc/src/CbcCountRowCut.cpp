@@ -14,6 +14,8 @@
 #include "CbcCountRowCut.hpp"
 #include "CbcNode.hpp"
 //#define CHECK_CUT_COUNTS
+// Cuts deleted with references left (see numberDeletedReferenced)
+static int numberDeletedReferenced_ = 0;
 // Default Constructor
 CbcCountRowCut::CbcCountRowCut ()
         :
@@ -63,6 +65,9 @@ CbcCountRowCut::~CbcCountRowCut()
     printf("CbcCountRowCut destructor %x - references %d\n", this,
            numberPointingToThis_);
 #endif
+    // very large counts are for cuts kept whatever
+    if (numberPointingToThis_ > 0 && numberPointingToThis_ < 900000000)
+        numberDeletedReferenced_++;
     // Look at owner and delete
     if (owner_)
         owner_->deleteCut(ownerCut_);
@@ -95,6 +100,12 @@ CbcCountRowCut::decrement(int change)
     return numberPointingToThis_;
 }
 
+// Number of cuts deleted while nodes still pointed to them
+int
+CbcCountRowCut::numberDeletedReferenced()
+{
+    return numberDeletedReferenced_;
+}
 // Set information
 void
 CbcCountRowCut::setInfo(CbcNodeInfo * info, int whichOne)
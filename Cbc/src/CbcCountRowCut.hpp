@@ -78,6 +78,11 @@ public:
         return numberPointingToThis_;
     }
 
+    /** Number of cuts deleted while nodes still pointed to them.
+        Search which takes cuts off all nodes it finishes leaves this
+        unchanged.  Not locked so only exact without threads. */
+    static int numberDeletedReferenced();
+
     /// Which generator for cuts - as user order
     inline int whichCutGenerator() const {
         return whichCutGenerator_;
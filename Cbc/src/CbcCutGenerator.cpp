@@ -50,7 +50,17 @@ CbcCutGenerator::CbcCutGenerator ()
         numberActiveCutsAtRoot_(0),
         numberShortCutsAtRoot_(0),
 	switches_(1),
-	maximumTries_(-1)
+	maximumTries_(-1),
+        accountedTime_(0.0),
+        objectiveChange_(0.0),
+        decisionTime_(0.0),
+        decisionObjectiveChange_(0.0),
+        numberCutsSurviving_(0),
+        decisionTimes_(0),
+        decisionCutsSurviving_(0),
+        adaptiveInterval_(1),
+        numberThrottles_(0),
+        numberBoosts_(0)
 {
 }
 // Normal constructor
@@ -74,7 +84,17 @@ CbcCutGenerator::CbcCutGenerator(CbcModel * model, CglCutGenerator * generator,
         numberActiveCutsAtRoot_(0),
         numberShortCutsAtRoot_(0),
         switches_(1),
-	maximumTries_(-1)
+	maximumTries_(-1),
+        accountedTime_(0.0),
+        objectiveChange_(0.0),
+        decisionTime_(0.0),
+        decisionObjectiveChange_(0.0),
+        numberCutsSurviving_(0),
+        decisionTimes_(0),
+        decisionCutsSurviving_(0),
+        adaptiveInterval_(1),
+        numberThrottles_(0),
+        numberBoosts_(0)
 {
     if (howOften < -1900) {
         setGlobalCuts(true);
@@ -124,6 +144,16 @@ CbcCutGenerator::CbcCutGenerator ( const CbcCutGenerator & rhs)
     numberCutsAtRoot_  = rhs.numberCutsAtRoot_;
     numberActiveCutsAtRoot_ = rhs.numberActiveCutsAtRoot_;
     numberShortCutsAtRoot_ = rhs.numberShortCutsAtRoot_;
+    accountedTime_ = rhs.accountedTime_;
+    objectiveChange_ = rhs.objectiveChange_;
+    decisionTime_ = rhs.decisionTime_;
+    decisionObjectiveChange_ = rhs.decisionObjectiveChange_;
+    numberCutsSurviving_ = rhs.numberCutsSurviving_;
+    decisionTimes_ = rhs.decisionTimes_;
+    decisionCutsSurviving_ = rhs.decisionCutsSurviving_;
+    adaptiveInterval_ = rhs.adaptiveInterval_;
+    numberThrottles_ = rhs.numberThrottles_;
+    numberBoosts_ = rhs.numberBoosts_;
 }
 
 // Assignment operator
@@ -155,6 +185,16 @@ CbcCutGenerator::operator=( const CbcCutGenerator & rhs)
         numberCutsAtRoot_  = rhs.numberCutsAtRoot_;
         numberActiveCutsAtRoot_ = rhs.numberActiveCutsAtRoot_;
         numberShortCutsAtRoot_ = rhs.numberShortCutsAtRoot_;
+        accountedTime_ = rhs.accountedTime_;
+        objectiveChange_ = rhs.objectiveChange_;
+        decisionTime_ = rhs.decisionTime_;
+        decisionObjectiveChange_ = rhs.decisionObjectiveChange_;
+        numberCutsSurviving_ = rhs.numberCutsSurviving_;
+        decisionTimes_ = rhs.decisionTimes_;
+        decisionCutsSurviving_ = rhs.decisionCutsSurviving_;
+        adaptiveInterval_ = rhs.adaptiveInterval_;
+        numberThrottles_ = rhs.numberThrottles_;
+        numberBoosts_ = rhs.numberBoosts_;
     }
     return *this;
 }
@@ -250,6 +290,10 @@ CbcCutGenerator::generateCuts( OsiCuts & cs , int fullScan, OsiSolverInterface *
     // But turn off if 100
     if (howOften == 100)
         doThis = false;
+    // Adaptive controller may have throttled generator in tree
+    if (adaptiveInterval_ > 1 && node &&
+            (model_->getNodeCount() % adaptiveInterval_) != 0)
+        doThis = false;
     // Switch off if special setting
     if (whenCutGeneratorInSub_ == -200 && model_->parentModel()) {
         fullScan = 0;
@@ -266,9 +310,8 @@ CbcCutGenerator::generateCuts( OsiCuts & cs , int fullScan, OsiSolverInterface *
                     clpSolver->getModelPtr()->randomNumberGenerator();
         }
 #endif
-        double time1 = 0.0;
-        if (timing())
-            time1 = CoinCpuTime();
+        // always timed for accounting
+        double time1 = CoinCpuTime();
         //#define CBC_DEBUG
         int numberRowCutsBefore = cs.sizeRowCuts() ;
         int numberColumnCutsBefore = cs.sizeColCuts() ;
@@ -1269,8 +1312,10 @@ CbcCutGenerator::generateCuts( OsiCuts & cs , int fullScan, OsiSolverInterface *
 #endif
             numberColumnCuts_ += numberColumnCutsAfter - numberColumnCutsBefore;
         }
+        double timeUsed = CoinCpuTime() - time1;
+        accountedTime_ += timeUsed;
         if (timing())
-            timeInCutGenerator_ += CoinCpuTime() - time1;
+            timeInCutGenerator_ += timeUsed;
         // switch off if first time and no good
         if (node == NULL && !pass ) {
             if (numberRowCutsAfter - numberRowCutsBefore
@@ -1339,6 +1384,63 @@ CbcCutGenerator::addStatistics(const CbcCutGenerator * other)
   numberActiveCutsAtRoot_ += other->numberActiveCutsAtRoot_;
   // Number of short cuts at root
   numberShortCutsAtRoot_ += other->numberShortCutsAtRoot_;
+  addAccounting(other);
+}
+// Add in accounting (time, objective change, decisions) from other
+void
+CbcCutGenerator::addAccounting(const CbcCutGenerator * other)
+{
+  accountedTime_ += other->accountedTime_;
+  objectiveChange_ += other->objectiveChange_;
+  numberCutsSurviving_ += other->numberCutsSurviving_;
+  numberThrottles_ += other->numberThrottles_;
+  numberBoosts_ += other->numberBoosts_;
+}
+/* Adaptive controller.
+   Benefit is objective change attributed to surviving cuts per second
+   in generator since last decision.  Generators which are a lot worse
+   than all generators together are called less often in tree, ones
+   which are better are called more often (first by undoing throttling
+   and then by reducing an adjustable howOften).
+*/
+int
+CbcCutGenerator::adaptFrequency(double referenceRate)
+{
+  if (whenCutGenerator_ == -100 || mustCallAgain() || whetherCallAtEnd())
+    return 0;
+  int numberCalls = numberTimes_ - decisionTimes_;
+  if (numberCalls < CBC_ADAPTIVE_CALLS)
+    return 0;
+  double time = recentTime();
+  double change = recentObjectiveChange();
+  int surviving = numberCutsSurviving_ - decisionCutsSurviving_;
+  double rate = change / CoinMax(time, 1.0e-6);
+  int decision = 0;
+  if (!surviving || rate < 0.1 * referenceRate) {
+    // throttle
+    if (adaptiveInterval_ < CBC_ADAPTIVE_MAXIMUM) {
+      adaptiveInterval_ *= 2;
+      numberThrottles_++;
+      decision = -1;
+    }
+  } else if (rate > 2.0 * referenceRate) {
+    // boost
+    int howOften = whenCutGenerator_ % 1000000;
+    if (adaptiveInterval_ > 1) {
+      adaptiveInterval_ /= 2;
+      numberBoosts_++;
+      decision = 1;
+    } else if (whenCutGenerator_ >= 1000000 && howOften > 1) {
+      whenCutGenerator_ = 1000000 + CoinMax(howOften / 2, 1);
+      numberBoosts_++;
+      decision = 1;
+    }
+  }
+  decisionTimes_ = numberTimes_;
+  decisionTime_ = accountedTime_;
+  decisionObjectiveChange_ = objectiveChange_;
+  decisionCutsSurviving_ = numberCutsSurviving_;
+  return decision;
 }
 // Scale back statistics by factor
 void 
@@ -1385,6 +1487,14 @@ CbcCutGenerator::generateTuning( FILE * fp)
         fprintf(fp, "   generator->setMustCallAgain(true);\n");
     if (whetherToUse())
         fprintf(fp, "   generator->setWhetherToUse(true);\n");
+    fprintf(fp, "// %d calls, %.2f seconds, %d cuts (%d survived pass) objective change %g\n",
+            numberTimes_, accountedTime_, numberCuts_, numberCutsSurviving_,
+            objectiveChange_);
+    if (numberThrottles_ || numberBoosts_)
+        fprintf(fp, "// adaptive control - throttled %d times, boosted %d times\n",
+                numberThrottles_, numberBoosts_);
+    if (adaptiveInterval_ > 1)
+        fprintf(fp, "   generator->setAdaptiveInterval(%d);\n", adaptiveInterval_);
 }
 
 
@@ -403,8 +403,59 @@ public:
         switches_ &= ~256;
         switches_ |= yesNo ? 256 : 0;
     }
+    /// Time in cut generator (kept even if not timing)
+    inline double accountedTime() const {
+        return accountedTime_;
+    }
+    /// Objective change attributed to cuts from this generator
+    inline double objectiveChange() const {
+        return objectiveChange_;
+    }
+    inline void incrementObjectiveChange(double value) {
+        objectiveChange_ += value;
+    }
+    /// Number of cuts still in LP after pass in which they were added
+    inline int numberCutsSurviving() const {
+        return numberCutsSurviving_;
+    }
+    inline void incrementNumberCutsSurviving(int value = 1) {
+        numberCutsSurviving_ += value;
+    }
+    /** Extra interval used by adaptive controller in tree.
+        Generator is only called at nodes which are a multiple of this
+        (as well as of howOften).  1 means no throttling */
+    inline int adaptiveInterval() const {
+        return adaptiveInterval_;
+    }
+    inline void setAdaptiveInterval(int value) {
+        adaptiveInterval_ = (value > 1) ? value : 1;
+    }
+    /// Number of times adaptive controller throttled generator
+    inline int numberThrottles() const {
+        return numberThrottles_;
+    }
+    /// Number of times adaptive controller boosted generator
+    inline int numberBoosts() const {
+        return numberBoosts_;
+    }
+    /// Time in generator since last adaptive decision
+    inline double recentTime() const {
+        return accountedTime_ - decisionTime_;
+    }
+    /// Objective change since last adaptive decision
+    inline double recentObjectiveChange() const {
+        return objectiveChange_ - decisionObjectiveChange_;
+    }
+    /** Adaptive controller.  Looks at objective change per second since
+        last decision and compares with referenceRate (the same for all
+        generators together).  Throttles (doubles adaptiveInterval)
+        if nothing survived or rate is poor, boosts if rate is good.
+        Returns -1 if throttled, 1 if boosted, 0 if no decision */
+    int adaptFrequency(double referenceRate);
     /// Add in statistics from other
     void addStatistics(const CbcCutGenerator * other);
+    /// Add in accounting (time, objective change, decisions) from other
+    void addAccounting(const CbcCutGenerator * other);
     /// Scale back statistics by factor
     void scaleBackStatistics(int factor);
     //@}
@@ -471,12 +522,36 @@ private:
     int switches_;
     /// Maximum number of times to enter
     int maximumTries_;
+    /// Time in cut generator (kept even if not timing)
+    double accountedTime_;
+    /// Objective change attributed to cuts from this generator
+    double objectiveChange_;
+    /// accountedTime_ at last adaptive decision
+    double decisionTime_;
+    /// objectiveChange_ at last adaptive decision
+    double decisionObjectiveChange_;
+    /// Number of cuts still in LP after pass in which they were added
+    int numberCutsSurviving_;
+    /// numberTimes_ at last adaptive decision
+    int decisionTimes_;
+    /// numberCutsSurviving_ at last adaptive decision
+    int decisionCutsSurviving_;
+    /// Extra interval used by adaptive controller in tree
+    int adaptiveInterval_;
+    /// Number of times adaptive controller throttled generator
+    int numberThrottles_;
+    /// Number of times adaptive controller boosted generator
+    int numberBoosts_;
 };
 
 // How often to do if mostly switched off (A)
 # define SCANCUTS 1000
 // How often to do if mostly switched off (probing B)
 # define SCANCUTS_PROBING 1000
+// Calls between adaptive decisions
+# define CBC_ADAPTIVE_CALLS 20
+// Maximum extra interval from adaptive controller
+# define CBC_ADAPTIVE_MAXIMUM 64
 
 #endif
 
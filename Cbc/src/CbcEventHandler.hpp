@@ -108,7 +108,10 @@ public:
         /*! Having generated cuts, allows user to think. */
         generatedCuts,
         /*! End of search. */
-        endSearch
+        endSearch,
+        /*! Tree size and time to go estimates updated
+            (see CbcModel::getEstimatedTreeNodes). */
+        treeEstimate
     } ;
 
     /*! \brief Action codes returned by the event handler.
@@ -9,6 +9,8 @@
 // Turn off compiler warning about long names
 #  pragma warning(disable:4786)
 #endif
+#include "CbcConfig.h"
+
 #include <cassert>
 #include <cstdlib>
 #include <cmath>
@@ -31,6 +33,160 @@
 #include "CoinWarmStartBasis.hpp"
 #include "ClpNode.hpp"
 #include "CbcBranchDynamic.hpp"
+#ifdef CBC_THREAD
+#include "CbcThread.hpp"
+#endif
+// Most variables split on before parallel mini trees
+#define CBC_LOOKAHEAD_MAXIMUM_SPLIT 4
+#define CBC_LOOKAHEAD_MAXIMUM_LEAVES (1<<CBC_LOOKAHEAD_MAXIMUM_SPLIT)
+#ifdef CBC_THREAD
+namespace {
+typedef struct {
+    OsiClpSolverInterface * solver; // clone with leaf bounds
+    ClpNodeStuff * info;
+    int whichSolution;
+    int numberIterations; // solving leaf
+    int status; // of leaf LP
+} CbcLookaheadThreadInfo;
+/*
+  Solve leaf (starting from parent basis) and do mini tree below it.
+*/
+void doLookaheadLeaf(CbcLookaheadThreadInfo * leaf)
+{
+    ClpNodeStuff * info = leaf->info;
+    info->nNodes_ = 0;
+    info->numberNodesExplored_ = 0;
+    info->numberIterations_ = 0;
+    leaf->whichSolution = -1;
+    OsiClpSolverInterface * solver = leaf->solver;
+    solver->setBasis();
+    ClpSimplex * simplex = solver->getModelPtr();
+    simplex->dual();
+    leaf->numberIterations = simplex->numberIterations();
+    leaf->status = simplex->status();
+    // nothing below if infeasible or cutoff (anything else is left to caller)
+    if (!leaf->status)
+        leaf->whichSolution = simplex->fathomMany(info);
+}
+}
+/*
+  Threads are kept for the life of the object so a lookahead does not
+  create them each time.  Worker i does leaf i+1, the caller leaf 0 and
+  any leaves whose thread could not be created.
+*/
+typedef struct {
+    struct CbcLookaheadPool * pool;
+    int which;
+} CbcLookaheadWorker;
+struct CbcLookaheadPool {
+    pthread_mutex_t mutex;
+    pthread_cond_t startCondition;
+    pthread_cond_t doneCondition;
+    int generation; // bumped when there is work
+    int numberRunning; // workers not finished with current work
+    int numberWorkers; // wanted
+    int numberStarted; // threads actually created
+    int numberLeaves; // in current work
+    bool stop;
+    CbcLookaheadThreadInfo * leaves;
+    CbcLookaheadWorker * workers;
+    Coin_pthread_t * threadId;
+};
+namespace {
+void * doLookaheadWorker(void * voidInfo)
+{
+    CbcLookaheadWorker * worker = reinterpret_cast<CbcLookaheadWorker *>(voidInfo);
+    CbcLookaheadPool * pool = worker->pool;
+    int generation = 0;
+    while (true) {
+        pthread_mutex_lock(&pool->mutex);
+        while (pool->generation == generation && !pool->stop)
+            pthread_cond_wait(&pool->startCondition, &pool->mutex);
+        if (pool->stop) {
+            pthread_mutex_unlock(&pool->mutex);
+            break;
+        }
+        generation = pool->generation;
+        int iLeaf = worker->which + 1;
+        CbcLookaheadThreadInfo * leaf = iLeaf < pool->numberLeaves ?
+                                        pool->leaves + iLeaf : NULL;
+        pthread_mutex_unlock(&pool->mutex);
+        if (leaf)
+            doLookaheadLeaf(leaf);
+        pthread_mutex_lock(&pool->mutex);
+        pool->numberRunning--;
+        if (!pool->numberRunning)
+            pthread_cond_signal(&pool->doneCondition);
+        pthread_mutex_unlock(&pool->mutex);
+    }
+    return NULL;
+}
+CbcLookaheadPool * newLookaheadPool(int numberWorkers)
+{
+    CbcLookaheadPool * pool = new CbcLookaheadPool;
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->startCondition, NULL);
+    pthread_cond_init(&pool->doneCondition, NULL);
+    pool->generation = 0;
+    pool->numberRunning = 0;
+    pool->numberWorkers = numberWorkers;
+    pool->numberStarted = 0;
+    pool->numberLeaves = 0;
+    pool->stop = false;
+    pool->leaves = NULL;
+    pool->workers = new CbcLookaheadWorker [numberWorkers];
+    pool->threadId = new Coin_pthread_t [numberWorkers];
+    for (int i = 0; i < numberWorkers; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].which = i;
+        // if no more threads then caller does rest of leaves
+        if (pthread_create(&(pool->threadId[i].thr), NULL, doLookaheadWorker,
+                           pool->workers + i))
+            break;
+        pool->numberStarted++;
+    }
+    return pool;
+}
+// Do leaves - caller does first
+void runLookaheadPool(CbcLookaheadPool * pool, CbcLookaheadThreadInfo * leaves,
+                      int numberLeaves)
+{
+    assert (numberLeaves <= pool->numberWorkers + 1);
+    pthread_mutex_lock(&pool->mutex);
+    pool->leaves = leaves;
+    pool->numberLeaves = numberLeaves;
+    pool->numberRunning = pool->numberStarted;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->startCondition);
+    pthread_mutex_unlock(&pool->mutex);
+    doLookaheadLeaf(leaves);
+    for (int iLeaf = pool->numberStarted + 1; iLeaf < numberLeaves; iLeaf++)
+        doLookaheadLeaf(leaves + iLeaf);
+    pthread_mutex_lock(&pool->mutex);
+    while (pool->numberRunning)
+        pthread_cond_wait(&pool->doneCondition, &pool->mutex);
+    pool->leaves = NULL;
+    pthread_mutex_unlock(&pool->mutex);
+}
+void deleteLookaheadPool(CbcLookaheadPool * pool)
+{
+    if (!pool)
+        return;
+    pthread_mutex_lock(&pool->mutex);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->startCondition);
+    pthread_mutex_unlock(&pool->mutex);
+    for (int i = 0; i < pool->numberStarted; i++)
+        pthread_join(pool->threadId[i].thr, NULL);
+    pthread_cond_destroy(&pool->startCondition);
+    pthread_cond_destroy(&pool->doneCondition);
+    pthread_mutex_destroy(&pool->mutex);
+    delete [] pool->workers;
+    delete [] pool->threadId;
+    delete pool;
+}
+}
+#endif
 // Default Constructor
 CbcGeneralDepth::CbcGeneralDepth ()
         : CbcGeneral(),
@@ -38,7 +194,12 @@ CbcGeneralDepth::CbcGeneralDepth ()
         maximumNodes_(0),
         whichSolution_(-1),
         numberNodes_(0),
-        nodeInfo_(NULL)
+        nodeInfo_(NULL),
+        numberThreads_(0),
+        splitDepth_(0),
+        leafInfo_(NULL),
+        nodes_(NULL),
+        pool_(NULL)
 {
 }
 
@@ -49,7 +210,12 @@ CbcGeneralDepth::CbcGeneralDepth (CbcModel * model, int maximumDepth)
         maximumNodes_(0),
         whichSolution_(-1),
         numberNodes_(0),
-        nodeInfo_(NULL)
+        nodeInfo_(NULL),
+        numberThreads_(0),
+        splitDepth_(0),
+        leafInfo_(NULL),
+        nodes_(NULL),
+        pool_(NULL)
 {
     assert(maximumDepth_ < 1000000);
     if (maximumDepth_ > 0)
@@ -89,6 +255,11 @@ CbcGeneralDepth::CbcGeneralDepth ( const CbcGeneralDepth & rhs)
     maximumNodes_ = rhs.maximumNodes_;
     whichSolution_ = -1;
     numberNodes_ = 0;
+    numberThreads_ = rhs.numberThreads_;
+    splitDepth_ = 0;
+    leafInfo_ = NULL;
+    nodes_ = NULL;
+    pool_ = NULL;
     if (maximumNodes_) {
         assert (rhs.nodeInfo_);
         nodeInfo_ = new ClpNodeStuff(*rhs.nodeInfo_);
@@ -125,10 +296,16 @@ CbcGeneralDepth::operator=( const CbcGeneralDepth & rhs)
     if (this != &rhs) {
         CbcGeneral::operator=(rhs);
         delete nodeInfo_;
+        deleteLeaves();
+#ifdef CBC_THREAD
+        deleteLookaheadPool(pool_);
+#endif
+        pool_ = NULL;
         maximumDepth_ = rhs.maximumDepth_;
         maximumNodes_ = rhs.maximumNodes_;
         whichSolution_ = -1;
         numberNodes_ = 0;
+        numberThreads_ = rhs.numberThreads_;
         if (maximumDepth_) {
             assert (rhs.nodeInfo_);
             nodeInfo_ = new ClpNodeStuff(*rhs.nodeInfo_);
@@ -144,6 +321,29 @@ CbcGeneralDepth::operator=( const CbcGeneralDepth & rhs)
 CbcGeneralDepth::~CbcGeneralDepth ()
 {
     delete nodeInfo_;
+    deleteLeaves();
+#ifdef CBC_THREAD
+    deleteLookaheadPool(pool_);
+#endif
+}
+// Delete leaf information
+void
+CbcGeneralDepth::deleteLeaves()
+{
+    if (leafInfo_) {
+        for (int i = 0; i < CBC_LOOKAHEAD_MAXIMUM_LEAVES; i++) {
+            if (leafInfo_[i]) {
+                // make sure all nodes used are deleted
+                leafInfo_[i]->nDepth_ = maximumDepth_ - 1;
+                delete leafInfo_[i];
+            }
+        }
+        delete [] leafInfo_;
+        leafInfo_ = NULL;
+    }
+    delete [] nodes_;
+    nodes_ = NULL;
+    splitDepth_ = 0;
 }
 // Infeasibility - large is 0.5
 double
@@ -190,12 +390,6 @@ CbcGeneralDepth::infeasibility(const OsiBranchingInformation * /*info*/,
                                   numberDownInfeasible,
                                   numberUpInfeasible, numberIntegers);
             info->presolveType_ = 1;
-            delete [] down;
-            delete [] up;
-            delete [] numberDown;
-            delete [] numberUp;
-            delete [] numberDownInfeasible;
-            delete [] numberUpInfeasible;
             bool takeHint;
             OsiHintStrength strength;
             solver->getHintParam(OsiDoReducePrint, takeHint, strength);
@@ -204,7 +398,25 @@ CbcGeneralDepth::infeasibility(const OsiBranchingInformation * /*info*/,
             if (strength != OsiHintIgnore && takeHint && saveLevel == 1)
                 simplex->setLogLevel(0);
             clpSolver->setBasis();
-            whichSolution_ = simplex->fathomMany(info);
+            whichSolution_ = -2;
+#ifdef CBC_THREAD
+            // not if tree search is threaded
+            if (numberThreads_ > 1 && maximumDepth_ > 1 && !model_->masterThread())
+                whichSolution_ = fathomParallel(simplex, down, up, priority,
+                                                numberDown, numberUp,
+                                                numberDownInfeasible,
+                                                numberUpInfeasible);
+#endif
+            if (whichSolution_ == -2) {
+                splitDepth_ = 0;
+                whichSolution_ = simplex->fathomMany(info);
+            }
+            delete [] down;
+            delete [] up;
+            delete [] numberDown;
+            delete [] numberUp;
+            delete [] numberDownInfeasible;
+            delete [] numberUpInfeasible;
             //printf("FAT %d nodes, %d iterations\n",
             //info->numberNodesExplored_,info->numberIterations_);
             //printf("CbcBranch %d rows, %d columns\n",clpSolver->getNumRows(),
@@ -301,6 +513,202 @@ CbcGeneralDepth::infeasibility(const OsiBranchingInformation * /*info*/,
     }
 }
 
+#ifdef CBC_THREAD
+/* Split on fractional integers and do mini trees below leaves in parallel.
+   Returns which node has solution, -1 if none or -2 if could not split */
+int
+CbcGeneralDepth::fathomParallel(ClpSimplex * simplex, const double * down,
+                                const double * up, const int * priority,
+                                const int * numberDown, const int * numberUp,
+                                const int * numberDownInfeasible,
+                                const int * numberUpInfeasible) const
+{
+    // one leaf per thread and leave something for mini tree
+    int maximumSplit = 0;
+    while ((2 << maximumSplit) <= numberThreads_ &&
+            maximumSplit + 1 < maximumDepth_ &&
+            maximumSplit < CBC_LOOKAHEAD_MAXIMUM_SPLIT)
+        maximumSplit++;
+    // choose on pseudo costs as in mini tree
+    int numberIntegers = model_->numberIntegers();
+    const int * integerVariable = model_->integerVariable();
+    OsiObject ** objects = model_->objects();
+    const double * solution = simplex->primalColumnSolution();
+    double integerTolerance = model_->getIntegerTolerance();
+    int split[CBC_LOOKAHEAD_MAXIMUM_SPLIT];
+    double splitScore[CBC_LOOKAHEAD_MAXIMUM_SPLIT];
+    int numberSplit = 0;
+    for (int i = 0; i < numberIntegers; i++) {
+        int iColumn = integerVariable[i];
+        double value = solution[iColumn];
+        double fraction = value - floor(value);
+        if (fraction < integerTolerance || fraction > 1.0 - integerTolerance)
+            continue;
+        CbcSimpleIntegerDynamicPseudoCost * obj =
+            dynamic_cast <CbcSimpleIntegerDynamicPseudoCost *>(objects[i]) ;
+        if (!obj)
+            continue;
+        double score = CoinMin(obj->downDynamicPseudoCost() * fraction,
+                               obj->upDynamicPseudoCost() * (1.0 - fraction));
+        // keep best first
+        int j = CoinMin(numberSplit, maximumSplit - 1);
+        if (numberSplit == maximumSplit && score <= splitScore[j])
+            continue;
+        while (j > 0 && splitScore[j-1] < score) {
+            splitScore[j] = splitScore[j-1];
+            split[j] = split[j-1];
+            j--;
+        }
+        splitScore[j] = score;
+        split[j] = iColumn;
+        if (numberSplit < maximumSplit)
+            numberSplit++;
+    }
+    if (!numberSplit)
+        return -2;
+    int numberLeaves = 1 << numberSplit;
+    ClpNodeStuff * info = nodeInfo_;
+    if (!leafInfo_) {
+        leafInfo_ = new ClpNodeStuff * [CBC_LOOKAHEAD_MAXIMUM_LEAVES];
+        for (int i = 0; i < CBC_LOOKAHEAD_MAXIMUM_LEAVES; i++)
+            leafInfo_[i] = NULL;
+        nodes_ = new ClpNode * [CBC_LOOKAHEAD_MAXIMUM_LEAVES*maximumNodes_];
+    }
+    OsiClpSolverInterface * clpSolver
+    = dynamic_cast<OsiClpSolverInterface *> (model_->solver());
+    assert (clpSolver && clpSolver->getModelPtr() == simplex);
+    CbcLookaheadThreadInfo * threadInfo = new CbcLookaheadThreadInfo [numberLeaves];
+    for (int iLeaf = 0; iLeaf < numberLeaves; iLeaf++) {
+        ClpNodeStuff * leafInfo = leafInfo_[iLeaf];
+        if (!leafInfo) {
+            leafInfo = new ClpNodeStuff();
+            leafInfo->maximumNodes_ = maximumNodes_;
+            // for reduced costs and duals
+            leafInfo->solverOptions_ |= 7;
+            ClpNode ** nodeInfo = new ClpNode * [maximumNodes_];
+            for (int i = 0; i < maximumNodes_; i++)
+                nodeInfo[i] = NULL;
+            leafInfo->nodeInfo_ = nodeInfo;
+            leafInfo_[iLeaf] = leafInfo;
+        }
+        leafInfo->nDepth_ = maximumDepth_ - numberSplit;
+        leafInfo->integerTolerance_ = info->integerTolerance_;
+        leafInfo->integerIncrement_ = info->integerIncrement_;
+        leafInfo->numberBeforeTrust_ = info->numberBeforeTrust_;
+        leafInfo->stateOfSearch_ = info->stateOfSearch_;
+        leafInfo->smallChange_ = info->smallChange_;
+        leafInfo->presolveType_ = info->presolveType_;
+        leafInfo->fillPseudoCosts(down, up, priority, numberDown, numberUp,
+                                  numberDownInfeasible,
+                                  numberUpInfeasible, numberIntegers);
+        // clone has parent basis so leaves share it as start
+        OsiClpSolverInterface * leafSolver =
+            dynamic_cast<OsiClpSolverInterface *> (clpSolver->clone());
+        leafSolver->getModelPtr()->setLogLevel(0);
+        for (int k = 0; k < numberSplit; k++) {
+            int iColumn = split[k];
+            double value = solution[iColumn];
+            if ((iLeaf & (1 << k)) == 0)
+                leafSolver->setColUpper(iColumn, floor(value));
+            else
+                leafSolver->setColLower(iColumn, ceil(value));
+        }
+        threadInfo[iLeaf].solver = leafSolver;
+        threadInfo[iLeaf].info = leafInfo;
+        threadInfo[iLeaf].whichSolution = -1;
+        threadInfo[iLeaf].numberIterations = 0;
+        threadInfo[iLeaf].status = 0;
+    }
+    int numberWorkers = (1 << maximumSplit) - 1;
+    if (pool_ && pool_->numberWorkers != numberWorkers) {
+        deleteLookaheadPool(pool_);
+        pool_ = NULL;
+    }
+    if (!pool_)
+        pool_ = newLookaheadPool(numberWorkers);
+    runLookaheadPool(pool_, threadInfo, numberLeaves);
+    /*
+      Only status 1 (infeasible or cutoff) lets a leaf be dropped.  If any
+      leaf stopped for another reason (iterations, time, ...) its subtree
+      would be lost so do serial mini tree from parent instead.
+    */
+    for (int iLeaf = 0; iLeaf < numberLeaves; iLeaf++) {
+        int status = threadInfo[iLeaf].status;
+        if (status != 0 && status != 1) {
+            for (int jLeaf = 0; jLeaf < numberLeaves; jLeaf++)
+                delete threadInfo[jLeaf].solver;
+            delete [] threadInfo;
+            return -2;
+        }
+    }
+    // only keep best solution (it will be new incumbent so others are worse)
+    int bestLeaf = -1;
+    double bestValue = COIN_DBL_MAX;
+    for (int iLeaf = 0; iLeaf < numberLeaves; iLeaf++) {
+        int which = threadInfo[iLeaf].whichSolution;
+        if (which >= 0) {
+            double value = leafInfo_[iLeaf]->nodeInfo_[which]->objectiveValue();
+            if (value < bestValue) {
+                bestValue = value;
+                bestLeaf = iLeaf;
+            }
+        }
+    }
+    int whichSolution = -1;
+    int numberNodes = 0;
+    int numberExplored = 0;
+    int numberIterations = 0;
+    for (int iLeaf = 0; iLeaf < numberLeaves; iLeaf++) {
+        ClpNodeStuff * leafInfo = leafInfo_[iLeaf];
+        int which = threadInfo[iLeaf].whichSolution;
+        for (int iNode = 0; iNode < leafInfo->nNodes_; iNode++) {
+            if (iNode == which) {
+                if (iLeaf != bestLeaf)
+                    continue;
+                whichSolution = numberNodes;
+            }
+            nodes_[numberNodes++] = leafInfo->nodeInfo_[iNode];
+        }
+        // count solving leaf as a node
+        numberExplored += leafInfo->numberNodesExplored_ + 1;
+        numberIterations += leafInfo->numberIterations_ +
+                            threadInfo[iLeaf].numberIterations;
+        delete threadInfo[iLeaf].solver;
+    }
+    delete [] threadInfo;
+    // add what each leaf learnt to pseudo costs
+    int extra = 1 - numberLeaves;
+    for (int i = 0; i < numberIntegers; i++) {
+        int numberDown = extra * info->numberDown_[i];
+        int numberUp = extra * info->numberUp_[i];
+        int numberDownInfeasible = extra * info->numberDownInfeasible_[i];
+        int numberUpInfeasible = extra * info->numberUpInfeasible_[i];
+        double downPseudo = extra * info->downPseudo_[i];
+        double upPseudo = extra * info->upPseudo_[i];
+        for (int iLeaf = 0; iLeaf < numberLeaves; iLeaf++) {
+            ClpNodeStuff * leafInfo = leafInfo_[iLeaf];
+            numberDown += leafInfo->numberDown_[i];
+            numberUp += leafInfo->numberUp_[i];
+            numberDownInfeasible += leafInfo->numberDownInfeasible_[i];
+            numberUpInfeasible += leafInfo->numberUpInfeasible_[i];
+            downPseudo += leafInfo->downPseudo_[i];
+            upPseudo += leafInfo->upPseudo_[i];
+        }
+        info->numberDown_[i] = numberDown;
+        info->numberUp_[i] = numberUp;
+        info->numberDownInfeasible_[i] = numberDownInfeasible;
+        info->numberUpInfeasible_[i] = numberUpInfeasible;
+        info->downPseudo_[i] = downPseudo;
+        info->upPseudo_[i] = upPseudo;
+    }
+    info->nNodes_ = numberNodes;
+    info->numberNodesExplored_ = numberExplored;
+    info->numberIterations_ = numberIterations;
+    splitDepth_ = numberSplit;
+    return whichSolution;
+}
+#endif
+
 // This looks at solution and sets bounds to contain solution
 void
 CbcGeneralDepth::feasibleRegion()
@@ -351,15 +759,15 @@ CbcGeneralDepth::createCbcBranch(OsiSolverInterface * solver, const OsiBranching
 					     numberColumns);
       double * upperBefore = CoinCopyOfArray(simplex->getColUpper(),
 					     numberColumns);
-      ClpNodeStuff * info = nodeInfo_;
       double * weight = new double[numberNodes_];
       int * whichNode = new int [numberNodes_];
       // Sort
       for (iNode = 0; iNode < numberNodes_; iNode++) {
         if (iNode != whichSolution_) {
-	  double objectiveValue = info->nodeInfo_[iNode]->objectiveValue();
-	  double sumInfeasibilities = info->nodeInfo_[iNode]->sumInfeasibilities();
-	  int numberInfeasibilities = info->nodeInfo_[iNode]->numberInfeasibilities();
+	  ClpNode * node = nodeInfo(iNode);
+	  double objectiveValue = node->objectiveValue();
+	  double sumInfeasibilities = node->sumInfeasibilities();
+	  int numberInfeasibilities = node->numberInfeasibilities();
 	  double thisWeight = 0.0;
 #if 1
 	  // just closest
@@ -367,7 +775,7 @@ CbcGeneralDepth::createCbcBranch(OsiSolverInterface * solver, const OsiBranching
 	  thisWeight += sumInfeasibilities;
 	  thisWeight += 1.0e-7 * objectiveValue;
 	  // Try estimate
-	  thisWeight = info->nodeInfo_[iNode]->estimatedSolution();
+	  thisWeight = node->estimatedSolution();
 #else
 	  thisWeight = 1.0e-3 * numberInfeasibilities;
 	  thisWeight += 1.0e-5 * sumInfeasibilities;
@@ -381,12 +789,13 @@ CbcGeneralDepth::createCbcBranch(OsiSolverInterface * solver, const OsiBranching
       CoinSort_2(weight, weight + numberDo, whichNode);
       for (iProb = 0; iProb < numberDo; iProb++) {
         iNode = whichNode[iProb];
-        ClpNode * node = info->nodeInfo_[iNode];
+        ClpNode * node = nodeInfo(iNode);
         // move bounds
         node->applyNode(simplex, 3);
-        // create subproblem
+        // create subproblem (depth from this node)
         sub[iProb] = CbcSubProblem(clpSolver, lowerBefore, upperBefore,
-                                   node->statusArray(), node->depth());
+                                   node->statusArray(),
+                                   node->depth() + splitDepth_);
         sub[iProb].objectiveValue_ = node->objectiveValue();
         sub[iProb].sumInfeasibilities_ = node->sumInfeasibilities();
         sub[iProb].numberInfeasibilities_ = node->numberInfeasibilities();
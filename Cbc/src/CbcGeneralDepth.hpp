@@ -16,10 +16,18 @@
 
 /** Define a catch all class.
     This will create a list of subproblems using partial evaluation
+
+    With threads (CBC_THREAD and setNumberThreads) the top of the mini
+    tree is split on the most promising fractional integers - one leaf per
+    thread - and the mini trees below the leaves are done at the same time
+    on clones of the solver.  All leaves start from the parent's optimal
+    basis.  The nodes from all leaves become children of the node.
+    The threads are started on first use and kept until the object goes.
 */
 #include "ClpSimplex.hpp"
 #include "ClpNode.hpp"
-
+/// Threads for parallel mini trees (only used with CBC_THREAD)
+struct CbcLookaheadPool;
 
 class CbcGeneralDepth : public CbcGeneral {
 
@@ -80,12 +88,33 @@ public:
     }
     /// Get ClpNode info
     inline ClpNode * nodeInfo(int which) {
-        return nodeInfo_->nodeInfo_[which];
+        return splitDepth_ ? nodes_[which] : nodeInfo_->nodeInfo_[which];
+    }
+    /// Get number of threads for mini tree (0 or 1 serial)
+    inline int numberThreads() const {
+        return numberThreads_;
+    }
+    /// Set number of threads for mini tree
+    inline void setNumberThreads(int value) {
+        numberThreads_ = value;
     }
 
     /// Redoes data when sequence numbers change
     virtual void redoSequenceEtc(CbcModel * model, int numberColumns, const int * originalColumns);
 
+private:
+    /** Split on fractional integers and do mini trees below leaves in
+        parallel.  Pseudo cost arrays are as from CbcModel::fillPseudoCosts.
+        Returns which node has solution, -1 if none or -2 if could not split
+    */
+    int fathomParallel(ClpSimplex * simplex, const double * down,
+                       const double * up, const int * priority,
+                       const int * numberDown, const int * numberUp,
+                       const int * numberDownInfeasible,
+                       const int * numberUpInfeasible) const;
+    /// Delete leaf information
+    void deleteLeaves();
+
 protected:
     /// data
     /// Maximum depth
@@ -98,6 +127,16 @@ protected:
     mutable int numberNodes_;
     /// For solving nodes
     mutable ClpNodeStuff * nodeInfo_;
+    /// Number of threads for mini tree
+    int numberThreads_;
+    /// Number of variables split on before mini trees (0 if serial)
+    mutable int splitDepth_;
+    /// For solving nodes below each leaf
+    mutable ClpNodeStuff ** leafInfo_;
+    /// Nodes from all leaves (not owned)
+    mutable ClpNode ** nodes_;
+    /// Threads for leaves (kept between lookaheads)
+    mutable CbcLookaheadPool * pool_;
 };
 /** Branching object for general objects
 
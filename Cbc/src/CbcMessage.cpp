@@ -69,6 +69,7 @@ static Cbc_message us_english[] = {
     {CBC_FATHOM_CHANGE, 49, 1, "Complete fathoming at depth >= %d"},
 #endif
     {CBC_MAXITERS, 50, 1, "Exiting on maximum number of iterations"},
+    {CBC_TREE_ESTIMATE, 51, 1, "Estimated %g nodes in tree, %.2f seconds to go"},
     {CBC_NOINT, 3007, 1, "No integer variables - nothing to do"},
     {CBC_WARNING_STRONG, 3008, 1, "Strong branching is fixing too many variables, too expensively!"},
     {CBC_DUMMY_END, 999999, 0, ""}
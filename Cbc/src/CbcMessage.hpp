@@ -72,6 +72,7 @@ enum CBC_Message {
     CBC_RESTART,
     CBC_GENERAL,
     CBC_ROOT_DETAIL,
+    CBC_TREE_ESTIMATE,
 #ifndef NO_FATHOM_PRINT
     CBC_FATHOM_CHANGE,
 #endif
@@ -61,6 +61,11 @@ extern int gomory_try;
 #include "CbcFeasibilityBase.hpp"
 #include "CbcFathom.hpp"
 #include "CbcFullNodeInfo.hpp"
+#include "CbcPropagation.hpp"
+#include "CbcConflictStore.hpp"
+#include "CbcModelCache.hpp"
+#include "CbcNodeTrace.hpp"
+#include "CbcProfile.hpp"
 #ifdef COIN_HAS_NTY
 #include "CbcSymmetry.hpp"
 #endif
@@ -70,6 +75,7 @@ extern int gomory_try;
 #include "CglTwomir.hpp"
 // include preprocessing
 #include "CglPreProcess.hpp"
+#include "CbcPreProcessProbing.hpp"
 #include "CglDuplicateRow.hpp"
 #include "CglStored.hpp"
 #include "CglClique.hpp"
@@ -90,6 +96,16 @@ typedef struct {
   int switches;
 } rootBundle;
 static void * doRootCbcThread(void * voidInfo);
+/* Effectiveness used to tag global cuts from the winning racing root model
+   so solveWithCuts adds them (once) at the root */
+static const double rootRacingCut = 1.0e50;
+/* Number of recent root cut passes fitted when looking for tailing off
+   (see CbcModel::tailingOff) */
+static const int maximumTailPasses = 6;
+/* Generator index tagging held (aged off) cuts added back at the root.
+   Like 20098 and 20099 (from the global cut pool) these are kept whatever
+   CbcModel::selectCuts thinks of them */
+static const int heldCutGenerator = 20097;
 
 namespace {
 
@@ -1970,6 +1986,24 @@ void CbcModel::branchAndBound(int doStatistics)
     // If dynamic pseudo costs then do
     if (numberBeforeTrust_)
         convertToDynamic();
+    // Pseudo costs and root cuts from last model of same structure
+    if (modelCache_ && !parentModel_) {
+        char general[200];
+        int numberSet = numberBeforeTrust_ ? modelCache_->restorePseudoCosts(this) : 0;
+        if (numberSet) {
+            sprintf(general, "Model cache - pseudo costs for %d integers from saved model",
+                    numberSet);
+            messageHandler()->message(CBC_GENERAL, messages())
+            << general << CoinMessageEol ;
+        }
+        int numberCuts = modelCache_->restoreRootCuts(this);
+        if (numberCuts) {
+            sprintf(general, "Model cache - %d root cuts from saved model added as global cuts",
+                    numberCuts);
+            messageHandler()->message(CBC_GENERAL, messages())
+            << general << CoinMessageEol ;
+        }
+    }
     // Set up char array to say if integer (speed)
     delete [] integerInfo_;
     {
@@ -2301,7 +2335,7 @@ void CbcModel::branchAndBound(int doStatistics)
             fastNodeDepth_ = -1;
 	    moreSpecialOptions_ &= ~33554432; // no diving
         }
-        if (numberThreads_ > 0) {
+        if (numberThreads_ > 0 && (threadMode_&16) == 0) {
 	    /* switch off fast nodes for now
 	       Trouble is that by time mini bab finishes code is
 	       looking at a different node
@@ -2505,6 +2539,10 @@ void CbcModel::branchAndBound(int doStatistics)
         }
 #endif
     }
+    tree_->setMessageHandler(handler_, &messages_);
+#ifdef CBC_THREAD
+    tree_->setNumberRebuildThreads(numberThreads_);
+#endif
     tree_->setComparison(*nodeCompare_) ;
     /*
       Used to record the path from a node to the root of the search tree, so that
@@ -2558,7 +2596,7 @@ void CbcModel::branchAndBound(int doStatistics)
     int iCutGenerator;
     for (iCutGenerator = 0; iCutGenerator < numberCutGenerators_; iCutGenerator++) {
         // If parallel switch off global cuts
-        if (numberThreads_) {
+        if (numberThreads_ && (threadMode_&16) == 0) {
             generator_[iCutGenerator]->setGlobalCuts(false);
             generator_[iCutGenerator]->setGlobalCutsAtRoot(false);
         }
@@ -2584,6 +2622,57 @@ void CbcModel::branchAndBound(int doStatistics)
     maximumStatistics_ = 0;
     maximumDepthActual_ = 0;
     numberDJFixed_ = 0.0;
+    timeInReducedCostFix_ = 0.0;
+    numberRootDJFixed_ = 0;
+    numberRootDJPasses_ = 0;
+    numberRootReducedCostFixes_ = 0;
+    rootObjectiveValue_ = -COIN_DBL_MAX;
+    delete [] rootReducedCost_;
+    rootReducedCost_ = NULL;
+    delete [] checkActivity_;
+    checkActivity_ = NULL;
+    delete [] checkReference_;
+    checkReference_ = NULL;
+    checkNumberRows_ = 0;
+    checkNumberColumns_ = 0;
+    checkUpdates_ = 0;
+    numberSolutionChecks_ = 0;
+    numberQuickChecks_ = 0;
+    numberCompressedBases_ = 0;
+    compressedBasisBytes_ = 0.0;
+    uncompressedBasisBytes_ = 0.0;
+    numberCutCandidates_ = 0;
+    numberCutsSelected_ = 0;
+    timeInCutSelection_ = 0.0;
+    numberCutResolves_ = 0;
+    cutResolveRows_ = 0.0;
+    timeInCutResolves_ = 0.0;
+    numberAgedCutsDeleted_ = 0;
+    numberCutDeletionBatches_ = 0;
+    numberHeldCutsAdded_ = 0;
+    if (profiling()) {
+        if (!profile_)
+            profile_ = new CbcProfile();
+        else
+            profile_->reset();
+    } else {
+        delete profile_;
+        profile_ = NULL;
+    }
+    numberTimelinePoints_ = 0;
+    lastTimelineSample_ = 0.0;
+    if (!parentModel_ && !timeline_) {
+        maximumTimelinePoints_ = 100;
+        timeline_ = new double [3*maximumTimelinePoints_];
+    }
+    treeLeafWeight_ = 0.0;
+    treeLeafSum_ = 0.0;
+    estimatedTreeNodes_ = -1.0;
+    estimatedSecondsLeft_ = -1.0;
+    gapStartTime_ = -1.0;
+    gapStart_ = 0.0;
+    treeStartSeconds_ = -1.0;
+    treeStartNodes_ = 0;
     if (!parentModel_) {
         if ((specialOptions_&262144) != 0) {
             // create empty stored cuts
@@ -2641,7 +2730,10 @@ void CbcModel::branchAndBound(int doStatistics)
     */
     // See if multiple runs wanted
     CbcModel ** rootModels=NULL;
+    // winner of racing root models (if any)
+    int rootWinner=-1;
     if (!parentModel_&&multipleRootTries_%100) {
+      double racingSeconds = dblParam_[CbcRootRacingSeconds];
       double rootTimeCpu=CoinCpuTime();
       double startTimeRoot=CoinGetTimeOfDay();
       int numberRootThreads=1;
@@ -2697,6 +2789,15 @@ void CbcModel::branchAndBound(int doStatistics)
 	rootModels[i]->setMoreSpecialOptions2(moreSpecialOptions2_ & 
 					      (~(128|256)));
 	rootModels[i]->solver_->setWarmStart(basis);
+	if (racingSeconds>0.0) {
+	  // racing - diversify algorithm and cut effort as well as seed
+	  rootModels[i]->setMaximumSeconds(CoinMin(getMaximumSeconds(),
+						   getCurrentSeconds()+racingSeconds));
+	  if ((i%3)==1)
+	    rootModels[i]->solver_->setHintParam(OsiDoDualInInitial,false,OsiHintDo);
+	  else if ((i%3)==2)
+	    rootModels[i]->setMaximumCutPassesAtRoot(2*maximumCutPassesAtRoot_);
+	}
 #ifdef COIN_HAS_CLP
 	OsiClpSolverInterface * clpSolver
 	  = dynamic_cast<OsiClpSolverInterface *> (rootModels[i]->solver_);
@@ -2803,7 +2904,7 @@ void CbcModel::branchAndBound(int doStatistics)
 	    -rootModels[iModel]->getMinimizationObjValue();
 	}
       }
-      char general[100];
+      char general[200];
       rootTimeCpu=CoinCpuTime()-rootTimeCpu;
       if (numberRootThreads==1)
 	sprintf(general,"Multiple root solvers took a total of %.2f seconds\n",
@@ -2830,6 +2931,89 @@ void CbcModel::branchAndBound(int doStatistics)
       lastHeuristic_=NULL;
       delete [] which;
       delete [] value;
+      if (racingSeconds>0.0&&feasible) {
+	/* Score racing models - fraction of gap closed by dual bound
+	   plus small bonuses for few fractional integers (a guess at
+	   tree size) and for owning the best incumbent */
+	double continuousObjective = solver_->getObjValue()*solver_->getObjSense();
+	double incumbent = getMinimizationObjValue();
+	double gapReference = (incumbent<1.0e50) ?
+	  incumbent-continuousObjective : 1.0+fabs(continuousObjective);
+	gapReference = CoinMax(gapReference,1.0e-6);
+	double integerTolerance = getIntegerTolerance();
+	double bestScore=-COIN_DBL_MAX;
+	for (int iModel=0;iModel<numberModels;iModel++) {
+	  const OsiSolverInterface * rootSolver = rootModels[iModel]->solver();
+	  if (!rootSolver->isProvenOptimal())
+	    continue;
+	  double bound = rootSolver->getObjValue()*rootSolver->getObjSense();
+	  const double * solution = rootSolver->getColSolution();
+	  int numberFractional=0;
+	  for (int j=0;j<numberIntegers_;j++) {
+	    double value = solution[integerVariable_[j]];
+	    if (fabs(value-floor(value+0.5))>integerTolerance)
+	      numberFractional++;
+	  }
+	  double score = (bound-continuousObjective)/gapReference +
+	    0.1*(1.0-static_cast<double>(numberFractional)/
+		 static_cast<double>(CoinMax(numberIntegers_,1)));
+	  if (rootModels[iModel]->bestSolution()&&
+	      rootModels[iModel]->getMinimizationObjValue()<=
+	      incumbent+1.0e-7*(1.0+fabs(incumbent)))
+	    score += 0.01;
+	  if (handler_->logLevel()>1) {
+	    sprintf(general,"Root model %d bound %g with %d fractional - score %g",
+		    iModel,bound,numberFractional,score);
+	    messageHandler()->message(CBC_GENERAL,messages())
+	      << general << CoinMessageEol ;
+	  }
+	  if (score>bestScore) {
+	    bestScore=score;
+	    rootWinner=iModel;
+	  }
+	}
+	if (rootWinner>=0) {
+	  CbcModel * winner = rootModels[rootWinner];
+	  // pseudocosts
+	  int numberCopied=0;
+	  for (int j=0;j<numberObjects_;j++) {
+	    CbcSimpleIntegerDynamicPseudoCost * obj =
+	      dynamic_cast <CbcSimpleIntegerDynamicPseudoCost *>(object_[j]) ;
+	    const CbcSimpleIntegerDynamicPseudoCost * winnerObj =
+	      dynamic_cast <const CbcSimpleIntegerDynamicPseudoCost *>(winner->object_[j]) ;
+	    if (obj&&winnerObj&&obj->columnNumber()==winnerObj->columnNumber()&&
+		winnerObj->numberTimesDown()+winnerObj->numberTimesUp()>0) {
+	      obj->copySome(winnerObj);
+	      numberCopied++;
+	    }
+	  }
+	  /* basis - winner's cuts will be added on first pass so only
+	     exact if all its cut slacks are basic */
+	  bool basisCopied=false;
+	  CoinWarmStartBasis * winnerBasis =
+	    dynamic_cast<CoinWarmStartBasis *>(winner->solver()->getWarmStart());
+	  if (winnerBasis) {
+	    int numberRows = solver_->getNumRows();
+	    bool allBasic=true;
+	    for (int iRow=numberRows;iRow<winnerBasis->getNumArtificial();iRow++) {
+	      if (winnerBasis->getArtifStatus(iRow)!=CoinWarmStartBasis::basic) {
+		allBasic=false;
+		break;
+	      }
+	    }
+	    if (allBasic&&winnerBasis->getNumStructural()==numberColumns) {
+	      winnerBasis->resize(numberRows,numberColumns);
+	      solver_->setWarmStart(winnerBasis);
+	      basisCopied=true;
+	    }
+	    delete winnerBasis;
+	  }
+	  sprintf(general,"Root model %d won race (score %g) - %d pseudocosts%s handed over",
+		  rootWinner,bestScore,numberCopied,basisCopied ? " and basis" : "");
+	  messageHandler()->message(CBC_GENERAL,messages())
+	    << general << CoinMessageEol ;
+	}
+      }
     }
     // Do heuristics
     if (numberObjects_&&!rootModels)
@@ -2854,6 +3038,7 @@ void CbcModel::branchAndBound(int doStatistics)
     stoppedOnGap_ = false ;
     // See if can stop on gap
     bestPossibleObjective_ = solver_->getObjValue() * solver_->getObjSense();
+    addTimelinePoint(bestPossibleObjective_);
     if(canStopOnGap()) {
         if (bestPossibleObjective_ < getCutoff())
             stoppedOnGap_ = true ;
@@ -2971,7 +3156,10 @@ void CbcModel::branchAndBound(int doStatistics)
 		  const OsiRowCutDebugger *debugger = NULL;
 		  if ((specialOptions_&1) != 0) 
 		    debugger = solver_->getRowCutDebugger() ;
-		  for (int iModel=0;iModel<numberModels;iModel++) {
+		  for (int jModel=0;jModel<numberModels;jModel++) {
+		    // racing winner first so its cuts win duplicate tests
+		    int iModel = (rootWinner>=0) ?
+		      (jModel+rootWinner)%numberModels : jModel;
 		    int numberRows2=solvers[iModel]->getNumRows();
 		    const CoinPackedMatrix * rowCopy = solvers[iModel]->getMatrixByRow();
 		    const int * rowLength = rowCopy->getVectorLengths(); 
@@ -2988,6 +3176,8 @@ void CbcModel::branchAndBound(int doStatistics)
 		      rc.setRow(rowLength[iRow],column+start,elements+start,false);
 		      if (debugger)
 			CoinAssert (!debugger->invalidCut(rc));
+		      if (iModel==rootWinner)
+			rc.setEffectiveness(rootRacingCut);
 		      globalCuts_.addCutIfNotDuplicate(rc);
 		    }
 		    //int cutsAdded=globalCuts_.numberCuts()-numberCuts;
@@ -3413,6 +3603,7 @@ void CbcModel::branchAndBound(int doStatistics)
     }
     // See if can stop on gap
     bestPossibleObjective_ = solver_->getObjValue() * solver_->getObjSense();
+    addTimelinePoint(bestPossibleObjective_);
     if(canStopOnGap()) {
         if (bestPossibleObjective_ < getCutoff())
             stoppedOnGap_ = true ;
@@ -3573,8 +3764,13 @@ void CbcModel::branchAndBound(int doStatistics)
 	  type=12;
 	else
 	  fastNodeDepth_ += 1000000;     // mark as done
-        CbcObject * obj =
-            new CbcGeneralDepth(this, type);
+        CbcGeneralDepth * depthObject = new CbcGeneralDepth(this, type);
+#ifdef CBC_THREAD
+        // threads in mini tree rather than tree search
+        if ((threadMode_&16) != 0)
+            depthObject->setNumberThreads(numberThreads_);
+#endif
+        CbcObject * obj = depthObject;
         addObjects(1, &obj);
         delete obj;
         // fake number of objects
@@ -4186,6 +4382,57 @@ void CbcModel::branchAndBound(int doStatistics)
                                               numberColumns);
         continuousInfeasibilities_ = newNode->numberUnsatisfied() ;
     }
+    /*
+      Save root reduced costs so that each new incumbent can fix variables
+      globally (rootReducedCostFix).  Only nonbasic integers at a bound with
+      a useful reduced cost are kept.
+    */
+    delete [] rootReducedCost_;
+    rootReducedCost_ = NULL;
+    if (newNode && newNode->branchingObject() && numberIntegers_ &&
+            solver_->isProvenOptimal() &&
+            solverCharacteristics_->reducedCostsAccurate()) {
+        double direction = solver_->getObjSense() ;
+        double tolerance;
+        solver_->getDblParam(OsiDualTolerance, tolerance) ;
+        double integerTolerance = getDblParam(CbcIntegerTolerance) ;
+        const double * lower = solver_->getColLower() ;
+        const double * upper = solver_->getColUpper() ;
+        const double * solution = solver_->getColSolution() ;
+        const double * reducedCost = solver_->getReducedCost() ;
+        rootReducedCost_ = new double [2*numberIntegers_];
+        double * bound = rootReducedCost_ + numberIntegers_;
+        int numberUseful = 0;
+        for (int i = 0; i < numberIntegers_; i++) {
+            int iColumn = integerVariable_[i];
+            double djValue = direction * reducedCost[iColumn];
+            rootReducedCost_[i] = 0.0;
+            bound[i] = 0.0;
+            if (djValue > tolerance &&
+                    solution[iColumn] < lower[iColumn] + integerTolerance) {
+                rootReducedCost_[i] = djValue;
+                bound[i] = lower[iColumn];
+                numberUseful++;
+            } else if (djValue < -tolerance &&
+                       solution[iColumn] > upper[iColumn] - integerTolerance) {
+                rootReducedCost_[i] = djValue;
+                bound[i] = upper[iColumn];
+                numberUseful++;
+            }
+        }
+        rootObjectiveValue_ = solver_->getObjValue() * direction;
+        if (!numberUseful) {
+            delete [] rootReducedCost_;
+            rootReducedCost_ = NULL;
+        }
+    }
+    /*
+      Keep root cuts for next model of same structure - only if reduced
+      cost fixing did nothing (cache checks cutoff and objective for rest).
+    */
+    if (modelCache_ && !parentModel_ && newNode &&
+            !numberRootReducedCostFixes_)
+        modelCache_->saveRootCuts(this);
     /*
       Bound may have changed so reset in objects
     */
@@ -4250,9 +4497,39 @@ void CbcModel::branchAndBound(int doStatistics)
     */
     numberLongStrong_ = 0;
     CbcNode * createdNode = NULL;
+    // bound propagation after branching (threads get copies)
+    delete propagation_;
+    propagation_ = NULL;
+    if (nodePropagation() && !solverCharacteristics_->solutionAddsCuts()) {
+        propagation_ = new CbcPropagation();
+        propagation_->initialize(continuousSolver_);
+    }
+    // learned conflicts (threads get copies and learn on their own)
+    delete conflicts_;
+    conflicts_ = NULL;
+    if (conflictLearning() && !solverCharacteristics_->solutionAddsCuts()) {
+        conflicts_ = new CbcConflictStore();
+        conflicts_->initialize(continuousSolver_);
+        /*
+          Bounds only explain an infeasible node if all branching is
+          bound changes on integers (not SOS, lotsizing or cuts).
+        */
+        bool allSimple = true;
+        for (int i = 0; i < numberObjects_; i++) {
+            if (!dynamic_cast <CbcSimpleInteger *> (object_[i])) {
+                allSimple = false;
+                break;
+            }
+        }
+        conflicts_->setLearnFromNodes(allSimple);
+    }
 #ifdef CBC_THREAD
     if ((specialOptions_&2048) != 0)
         numberThreads_ = 0;
+    // threads may be for mini trees - then search is serial
+    int saveNumberThreads = numberThreads_;
+    if ((threadMode_&16) != 0)
+        numberThreads_ = 0;
     if (numberThreads_ ) {
         nodeCompare_->sayThreaded(); // need to use addresses
         master_ = new CbcBaseModel(*this,
@@ -4734,6 +5011,8 @@ void CbcModel::branchAndBound(int doStatistics)
                     numberFixedNow_ = n;
                 }
             }
+            if (newCutoff > -COIN_DBL_MAX)
+                rootReducedCostFix(newCutoff);
             if (eventHandler) {
                 if (!eventHandler->event(CbcEventHandler::solution)) {
                     eventHappened_ = true; // exit
@@ -4746,7 +5025,9 @@ void CbcModel::branchAndBound(int doStatistics)
               node comparison predicate wants to make any changes. If so,
               call setComparison for the side effect of rebuilding the heap.
             */
+            CbcProfileTimer treeTimer(profile_, CBC_PROFILE_TREE);
             tree_->cleanTree(this,newCutoff,bestPossibleObjective_) ;
+            treeTimer.stop();
             if (nodeCompare_->newSolution(this) ||
                 nodeCompare_->newSolution(this,continuousObjective_,
                                           continuousInfeasibilities_)) {
@@ -4791,27 +5072,24 @@ void CbcModel::branchAndBound(int doStatistics)
             tree_->setComparison(*nodeCompare_) ;
             unlockThread();
         }
+        if (timeline_) {
+            // Take best possible for timeline now and then (scans tree)
+            double time = getCurrentSeconds();
+            if (time > lastTimelineSample_ + CoinMax(0.1, 0.01 * time)) {
+                lastTimelineSample_ = time;
+                lockThread();
+                if (!tree_->empty())
+                    addTimelinePoint(treeBestPossible());
+                unlockThread();
+            }
+        }
         if (numberNodes_ >= lastPrintEvery) {
             lastPrintEvery = numberNodes_ + printFrequency_;
             lockThread();
             int nNodes = tree_->size() ;
 
             //MODIF PIERRE
-            bestPossibleObjective_ = tree_->getBestPossibleObjective();
-#ifdef CBC_THREAD
-	    if (parallelMode() > 0 && master_) {
-	      // need to adjust for ones not on tree
-	      int numberThreads = master_->numberThreads();
-	      for (int i=0;i<numberThreads;i++) {
-		CbcThread * child = master_->child(i);
-		if (child->node()) {
-		  // adjust
-		  double value = child->node()->objectiveValue();
-		  bestPossibleObjective_ = CoinMin(bestPossibleObjective_, value);
-		}
-	      }
-	    }
-#endif
+            bestPossibleObjective_ = treeBestPossible();
             unlockThread();
 #if CBC_USEFUL_PRINTING>1
             if (getCutoff() < 1.0e20) {
@@ -4870,6 +5148,14 @@ void CbcModel::branchAndBound(int doStatistics)
             if (eventHandler && !eventHandler->event(CbcEventHandler::treeStatus)) {
                 eventHappened_ = true; // exit
             }
+            updateTreeEstimate();
+            if (estimatedTreeNodes_ >= 0.0 && estimatedSecondsLeft_ >= 0.0)
+                messageHandler()->message(CBC_TREE_ESTIMATE, messages())
+                << estimatedTreeNodes_ << estimatedSecondsLeft_
+                << CoinMessageEol ;
+            if (eventHandler && !eventHandler->event(CbcEventHandler::treeEstimate)) {
+                eventHappened_ = true; // exit
+            }
         }
         // See if can stop on gap
 	if(canStopOnGap()) {
@@ -4892,7 +5178,9 @@ void CbcModel::branchAndBound(int doStatistics)
 #ifdef CBC_THREAD
         if (!parallelMode() || parallelMode() == -1) {
 #endif
+            CbcProfileTimer treeTimer(profile_, CBC_PROFILE_TREE);
             node = tree_->bestNode(cutoff) ;
+            treeTimer.stop();
             // Possible one on tree worse than cutoff
             // Weird comparison function can leave ineligible nodes on tree
             if (!node || node->objectiveValue() > cutoff)
@@ -4943,7 +5231,9 @@ void CbcModel::branchAndBound(int doStatistics)
             // Deterministic parallel
 	  if ((tree_->size() < CoinMax(numberThreads_, 8)||
 	       hotstartSolution_) && !goneParallel) {
+                CbcProfileTimer treeTimer(profile_, CBC_PROFILE_TREE);
                 node = tree_->bestNode(cutoff) ;
+                treeTimer.stop();
                 // Possible one on tree worse than cutoff
                 if (!node || node->objectiveValue() > cutoff)
                     continue;
@@ -5078,6 +5368,7 @@ void CbcModel::branchAndBound(int doStatistics)
         master_ = NULL;
         masterThread_ = NULL;
     }
+    numberThreads_ = saveNumberThreads;
 #endif
     /*
       That's it, we've exhausted the search tree, or broken out of the loop because
@@ -5103,12 +5394,18 @@ void CbcModel::branchAndBound(int doStatistics)
         handler_->message(CBC_END_GOOD, messages_)
         << bestObjective_ << numberIterations_ << numberNodes_ << getCurrentSeconds()
         << CoinMessageEol ;
+        // tree is now known
+        if (numberNodes_) {
+            estimatedTreeNodes_ = numberNodes_;
+            estimatedSecondsLeft_ = 0.0;
+        }
     } else {
         handler_->message(CBC_END, messages_)
         << bestObjective_ << bestPossibleObjective_
         << numberIterations_ << numberNodes_ << getCurrentSeconds()
         << CoinMessageEol ;
     }
+    addTimelinePoint(bestPossibleObjective_, true);
     if ((moreSpecialOptions_&4194304)!=0) {
       // Conflict cuts
       int numberCuts = globalCuts_.sizeRowCuts();
@@ -5144,6 +5441,115 @@ void CbcModel::branchAndBound(int doStatistics)
         << maximumDepthActual_
         << numberDJFixed_ << numberFathoms_ << numberExtraNodes_ << numberExtraIterations_
         << CoinMessageEol ;
+    if (numberQuickChecks_) {
+        char general[200];
+        sprintf(general, "Solution checks - %d of %d accepted without LP",
+                numberQuickChecks_, numberSolutionChecks_);
+        messageHandler()->message(CBC_GENERAL, messages())
+        << general << CoinMessageEol ;
+    }
+    if (numberRootDJPasses_ || timeInReducedCostFix_ > 0.01) {
+        char general[200];
+        sprintf(general, "Reduced cost fixing - %d bounds changed globally from root reduced costs over %d new solutions (%.2f seconds in all)",
+                numberRootDJFixed_, numberRootDJPasses_, timeInReducedCostFix_);
+        messageHandler()->message(CBC_GENERAL, messages())
+        << general << CoinMessageEol ;
+    }
+    if (numberCompressedBases_) {
+        char general[200];
+        sprintf(general, "Node bases - %d compressed, average %.1f bytes per node (%.1f uncompressed)",
+                numberCompressedBases_,
+                compressedBasisBytes_ / numberCompressedBases_,
+                uncompressedBasisBytes_ / numberCompressedBases_);
+        messageHandler()->message(CBC_GENERAL, messages())
+        << general << CoinMessageEol ;
+    }
+    if (propagation_ && propagation_->numberCalls()) {
+        char general[200];
+        sprintf(general, "Node propagation - %d calls tightened %g bounds, %d nodes infeasible without LP (%.2f seconds)",
+                propagation_->numberCalls(), propagation_->numberTightened(),
+                propagation_->numberInfeasible(), propagation_->timeInPropagation());
+        messageHandler()->message(CBC_GENERAL, messages())
+        << general << CoinMessageEol ;
+    }
+    if (modelCache_ && !parentModel_ && numberBeforeTrust_)
+        modelCache_->savePseudoCosts(this);
+    if (conflicts_ && conflicts_->numberLearned()) {
+        char general[200];
+        sprintf(general, "Conflicts - %d learned, %d deleted, %d nodes pruned without LP (%.2f seconds)",
+                conflicts_->numberLearned(), conflicts_->numberDeleted(),
+                conflicts_->numberPruned(), conflicts_->timeInConflicts());
+        messageHandler()->message(CBC_GENERAL, messages())
+        << general << CoinMessageEol ;
+    }
+    if (adaptiveCutFrequency() && numberCutGenerators_ && !parentModel_) {
+        int numberThrottles = 0;
+        int numberBoosts = 0;
+        for (int i = 0; i < numberCutGenerators_; i++) {
+            numberThrottles += generator_[i]->numberThrottles();
+            numberBoosts += generator_[i]->numberBoosts();
+        }
+        char general[200];
+        sprintf(general, "Adaptive cut control - %d throttle and %d boost decisions",
+                numberThrottles, numberBoosts);
+        messageHandler()->message(CBC_GENERAL, messages())
+        << general << CoinMessageEol ;
+        if (handler_->logLevel() > 1)
+            generateTuning(stdout);
+    }
+    if (numberCutResolves_ && !parentModel_ &&
+            (cutSelection() || handler_->logLevel() > 1)) {
+        char general[200];
+        sprintf(general, "Cut loop - %d resolves averaging %.1f rows took %.2f seconds",
+                numberCutResolves_, cutResolveRows_ / numberCutResolves_,
+                timeInCutResolves_);
+        if (cutSelection())
+            sprintf(general + strlen(general), ", selection kept %d of %d cuts (%.2f seconds)",
+                    numberCutsSelected_, numberCutCandidates_, timeInCutSelection_);
+        else
+            strcat(general, ", no cut selection");
+        messageHandler()->message(CBC_GENERAL, messages())
+        << general << CoinMessageEol ;
+    }
+    if (cutAgeLimit_ > 0 && !parentModel_) {
+        char general[200];
+        sprintf(general, "Cut aging - %d cuts taken off in %d batches, %d held cuts added back",
+                numberAgedCutsDeleted_, numberCutDeletionBatches_,
+                numberHeldCutsAdded_);
+        messageHandler()->message(CBC_GENERAL, messages())
+        << general << CoinMessageEol ;
+    }
+    // not at default log level so normal output unchanged
+    if (numberTimelinePoints_ && !parentModel_ && handler_->logLevel() > 1) {
+        char general[200];
+        sprintf(general, "Integrals - primal %g, dual %g, primal-dual %g (gap seconds over %.2f seconds)",
+                primalIntegral(), dualIntegral(), primalDualIntegral(),
+                timeline_[3*numberTimelinePoints_-3]);
+        messageHandler()->message(CBC_GENERAL, messages())
+        << general << CoinMessageEol ;
+    }
+    if (profile_ && !parentModel_) {
+        // JSON is for profileReport() - just one line per section here
+        profile_->makeReport(this);
+        char general[200];
+        for (int i = 0; i < CBC_PROFILE_NUMBER; i++) {
+            if (!profile_->numberCalls(i))
+                continue;
+            sprintf(general, "Profile %s - %.0f calls, %.3f seconds",
+                    CbcProfile::sectionName(i), profile_->numberCalls(i),
+                    profile_->seconds(i));
+            messageHandler()->message(CBC_GENERAL, messages())
+            << general << CoinMessageEol ;
+        }
+    }
+    if (tree_->numberRebuilds() && handler_->logLevel() > 1) {
+        char general[200];
+        sprintf(general, "%d heap rebuilds took %.3f seconds (longest %.4f)",
+                tree_->numberRebuilds(), tree_->timeInRebuild(),
+                tree_->maximumRebuildTime());
+        messageHandler()->message(CBC_GENERAL, messages())
+        << general << CoinMessageEol ;
+    }
 #ifdef COIN_HAS_NTY
     if (symmetryInfo_) 
       symmetryInfo_->statsOrbits(this,1);
@@ -5523,10 +5929,19 @@ CbcModel::initialSolve()
     }
     solverCharacteristics_->setSolver(solver_);
     solver_->setHintParam(OsiDoInBranchAndCut, true, OsiHintDo, NULL) ;
-    solver_->initialSolve();
+    // warm start from cache if model of same structure seen before
+    if (modelCache_ && !parentModel_ && modelCache_->restoreBasis(solver_)) {
+        handler_->message(CBC_GENERAL, messages_)
+        << "Model cache - starting from saved basis" << CoinMessageEol ;
+        solver_->resolve();
+    } else {
+        solver_->initialSolve();
+    }
     solver_->setHintParam(OsiDoInBranchAndCut, false, OsiHintDo, NULL) ;
     if (!solver_->isProvenOptimal())
         solver_->resolve();
+    if (modelCache_ && !parentModel_ && solver_->isProvenOptimal())
+        modelCache_->saveBasis(solver_);
     // But set up so Jon Lee will be happy
     status_ = -1;
     secondaryStatus_ = -1;
@@ -5696,7 +6111,58 @@ CbcModel::CbcModel()
         statistics_(NULL),
         maximumDepthActual_(0),
         numberDJFixed_(0.0),
+        timeInReducedCostFix_(0.0),
+        numberRootDJFixed_(0),
+        numberRootDJPasses_(0),
+        numberRootReducedCostFixes_(0),
+        rootObjectiveValue_(-COIN_DBL_MAX),
+        rootReducedCost_(NULL),
+        reducedCostMark_(NULL),
+        sizeReducedCostMark_(0),
+        checkActivity_(NULL),
+        checkReference_(NULL),
+        checkNumberRows_(0),
+        checkNumberColumns_(0),
+        checkUpdates_(0),
+        numberSolutionChecks_(0),
+        numberQuickChecks_(0),
+        numberCompressedBases_(0),
+        compressedBasisBytes_(0.0),
+        uncompressedBasisBytes_(0.0),
+        maximumCutsPerRound_(0),
+        numberCutCandidates_(0),
+        numberCutsSelected_(0),
+        timeInCutSelection_(0.0),
+        numberCutResolves_(0),
+        cutResolveRows_(0.0),
+        timeInCutResolves_(0.0),
+        cutAgeLimit_(0),
+        cutDeletionBatch_(0),
+        cutAge_(NULL),
+        numberCutAges_(0),
+        maximumCutAges_(0),
+        numberAgedCutsDeleted_(0),
+        numberCutDeletionBatches_(0),
+        numberHeldCutsAdded_(0),
+        timeline_(NULL),
+        numberTimelinePoints_(0),
+        maximumTimelinePoints_(0),
+        lastTimelineSample_(0.0),
+        treeLeafWeight_(0.0),
+        treeLeafSum_(0.0),
+        estimatedTreeNodes_(-1.0),
+        estimatedSecondsLeft_(-1.0),
+        gapStartTime_(-1.0),
+        gapStart_(0.0),
+        treeStartSeconds_(-1.0),
+        treeStartNodes_(0),
         probingInfo_(NULL),
+        propagation_(NULL),
+        conflicts_(NULL),
+        modelCache_(NULL),
+        nodeTrace_(NULL),
+        nodeTraceThread_(0),
+        profile_(NULL),
         numberFixedAtRoot_(0),
         numberFixedNow_(0),
         stoppedOnGap_(false),
@@ -5866,7 +6332,58 @@ CbcModel::CbcModel(const OsiSolverInterface &rhs)
         statistics_(NULL),
         maximumDepthActual_(0),
         numberDJFixed_(0.0),
+        timeInReducedCostFix_(0.0),
+        numberRootDJFixed_(0),
+        numberRootDJPasses_(0),
+        numberRootReducedCostFixes_(0),
+        rootObjectiveValue_(-COIN_DBL_MAX),
+        rootReducedCost_(NULL),
+        reducedCostMark_(NULL),
+        sizeReducedCostMark_(0),
+        checkActivity_(NULL),
+        checkReference_(NULL),
+        checkNumberRows_(0),
+        checkNumberColumns_(0),
+        checkUpdates_(0),
+        numberSolutionChecks_(0),
+        numberQuickChecks_(0),
+        numberCompressedBases_(0),
+        compressedBasisBytes_(0.0),
+        uncompressedBasisBytes_(0.0),
+        maximumCutsPerRound_(0),
+        numberCutCandidates_(0),
+        numberCutsSelected_(0),
+        timeInCutSelection_(0.0),
+        numberCutResolves_(0),
+        cutResolveRows_(0.0),
+        timeInCutResolves_(0.0),
+        cutAgeLimit_(0),
+        cutDeletionBatch_(0),
+        cutAge_(NULL),
+        numberCutAges_(0),
+        maximumCutAges_(0),
+        numberAgedCutsDeleted_(0),
+        numberCutDeletionBatches_(0),
+        numberHeldCutsAdded_(0),
+        timeline_(NULL),
+        numberTimelinePoints_(0),
+        maximumTimelinePoints_(0),
+        lastTimelineSample_(0.0),
+        treeLeafWeight_(0.0),
+        treeLeafSum_(0.0),
+        estimatedTreeNodes_(-1.0),
+        estimatedSecondsLeft_(-1.0),
+        gapStartTime_(-1.0),
+        gapStart_(0.0),
+        treeStartSeconds_(-1.0),
+        treeStartNodes_(0),
         probingInfo_(NULL),
+        propagation_(NULL),
+        conflicts_(NULL),
+        modelCache_(NULL),
+        nodeTrace_(NULL),
+        nodeTraceThread_(0),
+        profile_(NULL),
         numberFixedAtRoot_(0),
         numberFixedNow_(0),
         stoppedOnGap_(false),
@@ -6153,7 +6670,58 @@ CbcModel::CbcModel(const CbcModel & rhs, bool cloneHandler)
         statistics_(NULL),
         maximumDepthActual_(0),
         numberDJFixed_(0.0),
+        timeInReducedCostFix_(0.0),
+        numberRootDJFixed_(0),
+        numberRootDJPasses_(0),
+        numberRootReducedCostFixes_(0),
+        rootObjectiveValue_(-COIN_DBL_MAX),
+        rootReducedCost_(NULL),
+        reducedCostMark_(NULL),
+        sizeReducedCostMark_(0),
+        checkActivity_(NULL),
+        checkReference_(NULL),
+        checkNumberRows_(0),
+        checkNumberColumns_(0),
+        checkUpdates_(0),
+        numberSolutionChecks_(0),
+        numberQuickChecks_(0),
+        numberCompressedBases_(0),
+        compressedBasisBytes_(0.0),
+        uncompressedBasisBytes_(0.0),
+        maximumCutsPerRound_(rhs.maximumCutsPerRound_),
+        numberCutCandidates_(0),
+        numberCutsSelected_(0),
+        timeInCutSelection_(0.0),
+        numberCutResolves_(0),
+        cutResolveRows_(0.0),
+        timeInCutResolves_(0.0),
+        cutAgeLimit_(rhs.cutAgeLimit_),
+        cutDeletionBatch_(rhs.cutDeletionBatch_),
+        cutAge_(NULL),
+        numberCutAges_(0),
+        maximumCutAges_(0),
+        numberAgedCutsDeleted_(0),
+        numberCutDeletionBatches_(0),
+        numberHeldCutsAdded_(0),
+        timeline_(NULL),
+        numberTimelinePoints_(0),
+        maximumTimelinePoints_(0),
+        lastTimelineSample_(0.0),
+        treeLeafWeight_(0.0),
+        treeLeafSum_(0.0),
+        estimatedTreeNodes_(-1.0),
+        estimatedSecondsLeft_(-1.0),
+        gapStartTime_(-1.0),
+        gapStart_(0.0),
+        treeStartSeconds_(-1.0),
+        treeStartNodes_(0),
         probingInfo_(NULL),
+        propagation_(rhs.propagation_ ? new CbcPropagation(*rhs.propagation_) : NULL),
+        conflicts_(rhs.conflicts_ ? new CbcConflictStore(*rhs.conflicts_) : NULL),
+        modelCache_(rhs.modelCache_),
+        nodeTrace_(rhs.nodeTrace_),
+        nodeTraceThread_(rhs.nodeTraceThread_),
+        profile_(rhs.profile_ ? new CbcProfile() : NULL),
         numberFixedAtRoot_(rhs.numberFixedAtRoot_),
         numberFixedNow_(rhs.numberFixedNow_),
         stoppedOnGap_(rhs.stoppedOnGap_),
@@ -6505,6 +7073,17 @@ CbcModel::operator=(const CbcModel & rhs)
         numberAnalyzeIterations_ = rhs.numberAnalyzeIterations_;
         delete [] analyzeResults_;
         analyzeResults_ = NULL;
+        delete [] rootReducedCost_;
+        rootReducedCost_ = NULL;
+        delete [] reducedCostMark_;
+        reducedCostMark_ = NULL;
+        sizeReducedCostMark_ = 0;
+        delete [] checkActivity_;
+        checkActivity_ = NULL;
+        delete [] checkReference_;
+        checkReference_ = NULL;
+        checkNumberRows_ = 0;
+        checkNumberColumns_ = 0;
         numberInfeasibleNodes_ = rhs.numberInfeasibleNodes_;
         problemType_ = rhs.problemType_;
         printFrequency_ = rhs.printFrequency_;
@@ -6535,6 +7114,9 @@ CbcModel::operator=(const CbcModel & rhs)
         delete [] generator_;
         delete [] virginGenerator_;
         delete [] heuristic_;
+        maximumCutsPerRound_ = rhs.maximumCutsPerRound_;
+        cutAgeLimit_ = rhs.cutAgeLimit_;
+        cutDeletionBatch_ = rhs.cutDeletionBatch_;
         maximumWhich_ = rhs.maximumWhich_;
         delete [] whichGenerator_;
         whichGenerator_ = NULL;
@@ -6551,6 +7133,19 @@ CbcModel::operator=(const CbcModel & rhs)
         statistics_ = NULL;
         delete probingInfo_;
         probingInfo_ = NULL;
+        delete propagation_;
+        propagation_ = rhs.propagation_ ? new CbcPropagation(*rhs.propagation_) : NULL;
+        delete conflicts_;
+        conflicts_ = rhs.conflicts_ ? new CbcConflictStore(*rhs.conflicts_) : NULL;
+        modelCache_ = rhs.modelCache_;
+        nodeTrace_ = rhs.nodeTrace_;
+        nodeTraceThread_ = rhs.nodeTraceThread_;
+        delete profile_;
+        profile_ = rhs.profile_ ? new CbcProfile(*rhs.profile_) : NULL;
+        delete [] timeline_;
+        timeline_ = NULL;
+        numberTimelinePoints_ = 0;
+        maximumTimelinePoints_ = 0;
         numberFixedAtRoot_ = rhs.numberFixedAtRoot_;
         numberFixedNow_ = rhs.numberFixedNow_;
         stoppedOnGap_ = rhs.stoppedOnGap_;
@@ -6753,6 +7348,10 @@ CbcModel::~CbcModel ()
     gutsOfDestructor();
     delete eventHandler_ ;
     eventHandler_ = NULL ;
+    delete profile_;
+    profile_ = NULL;
+    delete [] timeline_;
+    timeline_ = NULL;
 #ifdef CBC_THREAD
     // Get rid of all threaded stuff
     delete master_;
@@ -6867,6 +7466,50 @@ CbcModel::resetModel()
     statistics_ = NULL;
     maximumDepthActual_ = 0;
     numberDJFixed_ = 0.0;
+    timeInReducedCostFix_ = 0.0;
+    numberRootDJFixed_ = 0;
+    numberRootDJPasses_ = 0;
+    numberRootReducedCostFixes_ = 0;
+    rootObjectiveValue_ = -COIN_DBL_MAX;
+    delete [] rootReducedCost_;
+    rootReducedCost_ = NULL;
+    delete [] reducedCostMark_;
+    reducedCostMark_ = NULL;
+    sizeReducedCostMark_ = 0;
+    delete [] checkActivity_;
+    checkActivity_ = NULL;
+    delete [] checkReference_;
+    checkReference_ = NULL;
+    checkNumberRows_ = 0;
+    checkNumberColumns_ = 0;
+    checkUpdates_ = 0;
+    numberSolutionChecks_ = 0;
+    numberQuickChecks_ = 0;
+    numberCompressedBases_ = 0;
+    compressedBasisBytes_ = 0.0;
+    uncompressedBasisBytes_ = 0.0;
+    numberCutCandidates_ = 0;
+    numberCutsSelected_ = 0;
+    timeInCutSelection_ = 0.0;
+    numberCutResolves_ = 0;
+    cutResolveRows_ = 0.0;
+    timeInCutResolves_ = 0.0;
+    numberAgedCutsDeleted_ = 0;
+    numberCutDeletionBatches_ = 0;
+    numberHeldCutsAdded_ = 0;
+    numberTimelinePoints_ = 0;
+    treeLeafWeight_ = 0.0;
+    treeLeafSum_ = 0.0;
+    estimatedTreeNodes_ = -1.0;
+    estimatedSecondsLeft_ = -1.0;
+    gapStartTime_ = -1.0;
+    gapStart_ = 0.0;
+    treeStartSeconds_ = -1.0;
+    treeStartNodes_ = 0;
+    delete propagation_;
+    propagation_ = NULL;
+    delete conflicts_;
+    conflicts_ = NULL;
     if (probingInfo_) {
       delete probingInfo_;
       probingInfo_ = NULL;
@@ -7091,6 +7734,132 @@ CbcModel::moveInfo(const CbcModel & rhs)
     numberRowsAtContinuous_ = rhs.numberRowsAtContinuous_;
     cutoffRowNumber_ = rhs.cutoffRowNumber_;
     maximumDepth_ = rhs.maximumDepth_;
+    if (rhs.numberTimelinePoints_) {
+        if (maximumTimelinePoints_ < rhs.numberTimelinePoints_) {
+            delete [] timeline_;
+            maximumTimelinePoints_ = rhs.numberTimelinePoints_;
+            timeline_ = new double [3*maximumTimelinePoints_];
+        }
+        memcpy(timeline_, rhs.timeline_, 3*rhs.numberTimelinePoints_*sizeof(double));
+    }
+    numberTimelinePoints_ = rhs.numberTimelinePoints_;
+    estimatedTreeNodes_ = rhs.estimatedTreeNodes_;
+    estimatedSecondsLeft_ = rhs.estimatedSecondsLeft_;
+    if (rhs.profile_) {
+        if (!profile_)
+            profile_ = new CbcProfile(*rhs.profile_);
+        else
+            *profile_ = *rhs.profile_;
+    }
+}
+// Profile of last branch and bound as JSON
+const char *
+CbcModel::profileReport() const
+{
+    return profile_ ? profile_->report() : "";
+}
+// Best possible from tree (allowing for nodes in threads)
+double
+CbcModel::treeBestPossible()
+{
+    double bestPossible = tree_->getBestPossibleObjective();
+#ifdef CBC_THREAD
+    if (parallelMode() > 0 && master_) {
+        // need to adjust for ones not on tree
+        int numberThreads = master_->numberThreads();
+        for (int i = 0; i < numberThreads; i++) {
+            CbcThread * child = master_->child(i);
+            if (child->node()) {
+                // adjust
+                double value = child->node()->objectiveValue();
+                bestPossible = CoinMin(bestPossible, value);
+            }
+        }
+    }
+#endif
+    return bestPossible;
+}
+// Add point to timeline if incumbent or best possible changed
+void
+CbcModel::addTimelinePoint(double bestPossible, bool force)
+{
+    if (!timeline_)
+        return;
+    double incumbent = CoinMin(bestObjective_, 1.0e50);
+    if (numberTimelinePoints_) {
+        const double * last = timeline_ + 3 * numberTimelinePoints_ - 3;
+        // bound can only go up
+        bestPossible = CoinMin(CoinMax(bestPossible, last[2]), incumbent);
+        if (!force && incumbent == last[1] && bestPossible == last[2])
+            return;
+    } else {
+        bestPossible = CoinMin(bestPossible, incumbent);
+    }
+    if (numberTimelinePoints_ == maximumTimelinePoints_) {
+        maximumTimelinePoints_ *= 2;
+        double * temp = new double [3*maximumTimelinePoints_];
+        memcpy(temp, timeline_, 3*numberTimelinePoints_*sizeof(double));
+        delete [] timeline_;
+        timeline_ = temp;
+    }
+    double * point = timeline_ + 3 * numberTimelinePoints_;
+    point[0] = getCurrentSeconds();
+    point[1] = incumbent;
+    point[2] = bestPossible;
+    numberTimelinePoints_++;
+}
+// Gap as in primal integral - 1.0 if either missing or signs differ
+static double integralGap(double value1, double value2)
+{
+    if (fabs(value1) >= 1.0e50 || fabs(value2) >= 1.0e50)
+        return 1.0;
+    if (fabs(value1 - value2) < 1.0e-9)
+        return 0.0;
+    if (value1 * value2 < 0.0)
+        return 1.0;
+    return fabs(value1 - value2) / CoinMax(fabs(value1), fabs(value2));
+}
+// Integral of gap over timeline (which 1 incumbent, 2 bound, 3 both)
+static double timelineIntegral(const double * timeline, int numberPoints,
+                               int which, double reference)
+{
+    double integral = 0.0;
+    double lastTime = 0.0;
+    double gap = 1.0;
+    for (int i = 0; i < numberPoints; i++) {
+        const double * point = timeline + 3 * i;
+        integral += gap * CoinMax(point[0] - lastTime, 0.0);
+        lastTime = point[0];
+        if (which == 1)
+            gap = integralGap(point[1], reference);
+        else if (which == 2)
+            gap = integralGap(point[2], reference);
+        else
+            gap = integralGap(point[1], point[2]);
+    }
+    return integral;
+}
+// Primal integral of last branch and bound
+double
+CbcModel::primalIntegral(double reference) const
+{
+    if (reference == COIN_DBL_MAX)
+        reference = bestObjective_;
+    return timelineIntegral(timeline_, numberTimelinePoints_, 1, reference);
+}
+// Dual integral of last branch and bound
+double
+CbcModel::dualIntegral(double reference) const
+{
+    if (reference == COIN_DBL_MAX)
+        reference = bestObjective_;
+    return timelineIntegral(timeline_, numberTimelinePoints_, 2, reference);
+}
+// Primal-dual integral of last branch and bound
+double
+CbcModel::primalDualIntegral() const
+{
+    return timelineIntegral(timeline_, numberTimelinePoints_, 3, 0.0);
 }
 // Save a copy of the current solver so can be reset to
 void
@@ -7459,6 +8228,7 @@ bool CbcModel::addCuts1 (CbcNode * node, CoinWarmStartBasis *&lastws)
 */
 int CbcModel::addCuts (CbcNode *node, CoinWarmStartBasis *&lastws)
 {
+    CbcProfileTimer addCutsTimer(profile_, CBC_PROFILE_ADD_CUTS);
     /*
       addCuts1 performs step 1 of restoring the subproblem at this node; see the
       comments there.
@@ -7720,6 +8490,33 @@ CbcModel::synchronizeHandlers(int /*makeDefault*/)
 }
 
 
+/*
+  Mark candidates for reduced cost fixing - 1 fix at lower, 2 at upper.
+  Straight loop over contiguous arrays with no data dependent branches
+  so the compiler can vectorize it.  Returns number of candidates.
+*/
+static int
+reducedCostCandidates(int n, const double * lower, const double * upper,
+                      const double * solution, const double * reducedCost,
+                      double direction, double gap, double integerTolerance,
+                      char * mark)
+{
+    int numberCandidates = 0;
+    for (int i = 0; i < n; i++) {
+        double djValue = direction * reducedCost[i];
+        double boundGap = upper[i] - lower[i];
+        int open = boundGap > integerTolerance;
+        int atLower = (solution[i] < lower[i] + integerTolerance) &
+                      (djValue * boundGap > gap);
+        int atUpper = (solution[i] > upper[i] - integerTolerance) &
+                      (-djValue > boundGap * gap);
+        int value = open * (atLower + 2 * atUpper);
+        mark[i] = static_cast<char> (value);
+        numberCandidates += (value != 0);
+    }
+    return numberCandidates;
+}
+
 /*
   Perform reduced cost fixing on integer variables.
 
@@ -7731,6 +8528,7 @@ int CbcModel::reducedCostFix ()
 {
     if (!solverCharacteristics_->reducedCostsAccurate())
         return 0; //NLP
+    double time1 = CoinCpuTime();
     double cutoff = getCutoff() ;
     double direction = solver_->getObjSense() ;
     double gap = cutoff - solver_->getObjValue() * direction ;
@@ -7748,6 +8546,23 @@ int CbcModel::reducedCostFix ()
 
     int numberFixed = 0 ;
     int numberTightened = 0 ;
+    /*
+      Most of the time nothing can be fixed so first find candidates
+      over all columns in one pass.
+    */
+    int numberColumns = solver_->getNumCols();
+    if (numberColumns > sizeReducedCostMark_) {
+        delete [] reducedCostMark_;
+        sizeReducedCostMark_ = numberColumns;
+        reducedCostMark_ = new char [sizeReducedCostMark_];
+    }
+    char * mark = reducedCostMark_;
+    if (!reducedCostCandidates(numberColumns, lower, upper, solution,
+                               reducedCost, direction, gap, integerTolerance,
+                               mark)) {
+        timeInReducedCostFix_ += CoinCpuTime() - time1;
+        return 0;
+    }
 
 # ifdef COIN_HAS_CLP
     OsiClpSolverInterface * clpSolver
@@ -7758,72 +8573,134 @@ int CbcModel::reducedCostFix ()
 # endif
     for (int i = 0 ; i < numberIntegers_ ; i++) {
         int iColumn = integerVariable_[i] ;
+        if (!mark[iColumn])
+            continue;
         double djValue = direction * reducedCost[iColumn] ;
         double boundGap = upper[iColumn] - lower[iColumn];
-        if (boundGap > integerTolerance) {
-            if (solution[iColumn] < lower[iColumn] + integerTolerance
-                    && djValue*boundGap > gap) {
+        if (mark[iColumn] == 1) {
 #ifdef COIN_HAS_CLP
-                // may just have been fixed before
-                if (clpSimplex) {
-                    if (clpSimplex->getColumnStatus(iColumn) == ClpSimplex::basic) {
+            // may just have been fixed before
+            if (clpSimplex) {
+                if (clpSimplex->getColumnStatus(iColumn) == ClpSimplex::basic) {
 #ifdef COIN_DEVELOP
-                        printf("DJfix %d has status of %d, dj of %g gap %g, bounds %g %g\n",
-                               iColumn, clpSimplex->getColumnStatus(iColumn),
-                               djValue, gap, lower[iColumn], upper[iColumn]);
+                    printf("DJfix %d has status of %d, dj of %g gap %g, bounds %g %g\n",
+                           iColumn, clpSimplex->getColumnStatus(iColumn),
+                           djValue, gap, lower[iColumn], upper[iColumn]);
 #endif
-                    } else {
-                        assert(clpSimplex->getColumnStatus(iColumn) == ClpSimplex::atLowerBound ||
-                               clpSimplex->getColumnStatus(iColumn) == ClpSimplex::isFixed);
-                    }
+                } else {
+                    assert(clpSimplex->getColumnStatus(iColumn) == ClpSimplex::atLowerBound ||
+                           clpSimplex->getColumnStatus(iColumn) == ClpSimplex::isFixed);
                 }
+            }
 #endif
-                double newBound = lower[iColumn];
-                if (boundGap > 1.99) {
-                    boundGap = gap / djValue + 1.0e-4 * boundGap;
-                    newBound = lower[iColumn] + floor(boundGap);
-                    numberTightened++;
-                    //if (newBound)
-                    //printf("tighter - gap %g dj %g newBound %g\n",
-                    //   gap,djValue,newBound);
-                }
-                solver_->setColUpper(iColumn, newBound) ;
-                numberFixed++ ;
-            } else if (solution[iColumn] > upper[iColumn] - integerTolerance && -djValue > boundGap*gap) {
+            double newBound = lower[iColumn];
+            if (boundGap > 1.99) {
+                boundGap = gap / djValue + 1.0e-4 * boundGap;
+                newBound = lower[iColumn] + floor(boundGap);
+                numberTightened++;
+                //if (newBound)
+                //printf("tighter - gap %g dj %g newBound %g\n",
+                //   gap,djValue,newBound);
+            }
+            solver_->setColUpper(iColumn, newBound) ;
+            numberFixed++ ;
+        } else {
 #ifdef COIN_HAS_CLP
-                // may just have been fixed before
-                if (clpSimplex) {
-                    if (clpSimplex->getColumnStatus(iColumn) == ClpSimplex::basic) {
+            // may just have been fixed before
+            if (clpSimplex) {
+                if (clpSimplex->getColumnStatus(iColumn) == ClpSimplex::basic) {
 #ifdef COIN_DEVELOP
-                        printf("DJfix %d has status of %d, dj of %g gap %g, bounds %g %g\n",
-                               iColumn, clpSimplex->getColumnStatus(iColumn),
-                               djValue, gap, lower[iColumn], upper[iColumn]);
+                    printf("DJfix %d has status of %d, dj of %g gap %g, bounds %g %g\n",
+                           iColumn, clpSimplex->getColumnStatus(iColumn),
+                           djValue, gap, lower[iColumn], upper[iColumn]);
 #endif
-                    } else {
-                        assert(clpSimplex->getColumnStatus(iColumn) == ClpSimplex::atUpperBound ||
-                               clpSimplex->getColumnStatus(iColumn) == ClpSimplex::isFixed);
-                    }
+                } else {
+                    assert(clpSimplex->getColumnStatus(iColumn) == ClpSimplex::atUpperBound ||
+                           clpSimplex->getColumnStatus(iColumn) == ClpSimplex::isFixed);
                 }
+            }
 #endif
-                double newBound = upper[iColumn];
-                if (boundGap > 1.99) {
-                    boundGap = -gap / djValue + 1.0e-4 * boundGap;
-                    newBound = upper[iColumn] - floor(boundGap);
-                    //if (newBound)
-                    //printf("tighter - gap %g dj %g newBound %g\n",
-                    //   gap,djValue,newBound);
-                    numberTightened++;
-                }
-                solver_->setColLower(iColumn, newBound) ;
-                numberFixed++ ;
+            double newBound = upper[iColumn];
+            if (boundGap > 1.99) {
+                boundGap = -gap / djValue + 1.0e-4 * boundGap;
+                newBound = upper[iColumn] - floor(boundGap);
+                //if (newBound)
+                //printf("tighter - gap %g dj %g newBound %g\n",
+                //   gap,djValue,newBound);
+                numberTightened++;
             }
+            solver_->setColLower(iColumn, newBound) ;
+            numberFixed++ ;
         }
     }
     numberDJFixed_ += numberFixed - numberTightened;
+    if (!numberNodes_)
+        numberRootReducedCostFixes_ += numberFixed;
 #ifdef SWITCH_VARIABLES
     if (numberFixed)
       fixAssociated(NULL,0);
 #endif
+    timeInReducedCostFix_ += CoinCpuTime() - time1;
+    return numberFixed;
+}
+/*
+  Fix using reduced costs saved after root LP.  Any solution with an
+  integer moved k from the bound it was at in root LP has objective at
+  least root objective + k*|dj|, so with new cutoff it can move at most
+  gap/|dj|.  Bounds are tightened in root node (as makeGlobalCut does).
+*/
+int CbcModel::rootReducedCostFix (double cutoff)
+{
+    if (!rootReducedCost_ || !topOfTree_)
+        return 0;
+    double gap = cutoff - rootObjectiveValue_;
+    if (gap < 0.0)
+        return 0; // nothing left anyway
+    double time1 = CoinCpuTime();
+    double tolerance;
+    solver_->getDblParam(OsiDualTolerance, tolerance) ;
+    gap += 100.0 * tolerance;
+    const double * reducedCost = rootReducedCost_;
+    const double * bound = rootReducedCost_ + numberIntegers_;
+    // how far each may move - straight loop so can be vectorized
+    double * move = new double [numberIntegers_];
+    for (int i = 0; i < numberIntegers_; i++) {
+        double djValue = fabs(reducedCost[i]);
+        move[i] = (djValue > 0.0) ? floor(gap / djValue + 1.0e-4) : COIN_DBL_MAX;
+    }
+    const double * lower = topOfTree_->lower();
+    const double * upper = topOfTree_->upper();
+    int numberFixed = 0;
+    for (int i = 0; i < numberIntegers_; i++) {
+        if (move[i] == COIN_DBL_MAX)
+            continue;
+        int iColumn = integerVariable_[i];
+        if (reducedCost[i] > 0.0) {
+            double newUpper = CoinMax(bound[i] + move[i], lower[iColumn]);
+            if (newUpper < upper[iColumn] - 0.5) {
+                topOfTree_->setColUpper(iColumn, newUpper);
+                numberFixed++;
+            }
+        } else {
+            double newLower = CoinMin(bound[i] - move[i], upper[iColumn]);
+            if (newLower > lower[iColumn] + 0.5) {
+                topOfTree_->setColLower(iColumn, newLower);
+                numberFixed++;
+            }
+        }
+    }
+    delete [] move;
+    numberRootDJFixed_ += numberFixed;
+    numberRootDJPasses_++;
+    double time = CoinCpuTime() - time1;
+    timeInReducedCostFix_ += time;
+    if (numberFixed && handler_->logLevel() > 1) {
+        char general[200];
+        sprintf(general, "New solution - root reduced costs changed %d bounds (%d in all) in %.3f seconds",
+                numberFixed, numberRootDJFixed_, time);
+        messageHandler()->message(CBC_GENERAL, messages())
+        << general << CoinMessageEol ;
+    }
     return numberFixed;
 }
 // Collect coding to replace whichGenerator
@@ -7845,6 +8722,290 @@ CbcModel::resizeWhichGenerator(int numberNow, int numberAfter)
         memset(whichGenerator_ + numberNow, 0, (maximumWhich_ - numberNow)*sizeof(int));
     }
 }
+// Count new cuts in solver by generator
+void
+CbcModel::countNewCutsByGenerator(int * count) const
+{
+    memset(count, 0, numberCutGenerators_*sizeof(int));
+    for (int i = 0; i < numberNewCuts_; i++) {
+        int iGenerator = whichGenerator_[i];
+        if (iGenerator >= 0) {
+            iGenerator = iGenerator % 10000;
+            if (iGenerator < numberCutGenerators_)
+                count[iGenerator]++;
+        }
+    }
+}
+/* Credit generators with cuts which stayed in after a pass.
+   Objective change of pass is shared in proportion to surviving cuts
+   (column cuts and cuts which have since gone get nothing).
+*/
+void
+CbcModel::creditCutGenerators(int * count, double objectiveChange)
+{
+    int * countAfter = count + numberCutGenerators_;
+    countNewCutsByGenerator(countAfter);
+    int numberSurviving = 0;
+    for (int i = 0; i < numberCutGenerators_; i++) {
+        int n = CoinMax(countAfter[i] - count[i], 0);
+        count[i] = n;
+        numberSurviving += n;
+    }
+    if (!numberSurviving)
+        return;
+    double share = CoinMax(objectiveChange, 0.0) / static_cast<double> (numberSurviving);
+    for (int i = 0; i < numberCutGenerators_; i++) {
+        if (count[i]) {
+            generator_[i]->incrementNumberCutsSurviving(count[i]);
+            generator_[i]->incrementObjectiveChange(share * count[i]);
+        }
+    }
+}
+/* Adaptive control of cut generator frequency in tree.
+   Reference is objective change per second for all generators together
+   since their last decisions.
+*/
+void
+CbcModel::adaptCutGenerators()
+{
+    double sumTime = 0.0;
+    double sumChange = 0.0;
+    for (int i = 0; i < numberCutGenerators_; i++) {
+        sumTime += generator_[i]->recentTime();
+        sumChange += generator_[i]->recentObjectiveChange();
+    }
+    double referenceRate = sumChange / CoinMax(sumTime, 1.0e-6);
+    for (int i = 0; i < numberCutGenerators_; i++) {
+        int decision = generator_[i]->adaptFrequency(referenceRate);
+        if (decision && handler_->logLevel() > 2) {
+            char general[200];
+            sprintf(general, "Cut generator %d (%s) %s - interval %d, how often %d",
+                    i, generator_[i]->cutGeneratorName(),
+                    decision < 0 ? "throttled" : "boosted",
+                    generator_[i]->adaptiveInterval(),
+                    generator_[i]->howOften() % 1000000);
+            messageHandler()->message(CBC_GENERAL, messages())
+            << general << CoinMessageEol ;
+        }
+    }
+}
+/* Tailing off at root.
+   Rate of bound improvement per second over recent passes is fitted as
+   exp(a-lambda*t) by least squares on log of rate.  Gain from another
+   pass of average length is predicted from the fit (or from the last
+   rate if it is not falling) as a fraction of gap (of bound if no
+   solution).  Closing that fraction of gap is taken to save that
+   fraction of the work still to do, estimated as the time so far, so
+   return is (fraction of gap)/(pass time/time so far).
+*/
+bool
+CbcModel::tailingOff(const double * passTime, const double * passObjective,
+                     int numberPoints, char * explanation) const
+{
+    // need three gains
+    if (numberPoints < 4)
+        return false;
+    double bound = passObjective[numberPoints-1];
+    double tiny = 1.0e-12 * (1.0 + fabs(bound));
+    double sumX = 0.0;
+    double sumY = 0.0;
+    double sumXX = 0.0;
+    double sumXY = 0.0;
+    int n = numberPoints - 1;
+    double lastRate = 0.0;
+    for (int k = 1; k < numberPoints; k++) {
+        double deltaTime = CoinMax(passTime[k] - passTime[k-1], 1.0e-6);
+        double gain = CoinMax(passObjective[k] - passObjective[k-1], tiny);
+        lastRate = gain / deltaTime;
+        double x = 0.5 * (passTime[k] + passTime[k-1]);
+        double y = log(lastRate);
+        sumX += x;
+        sumY += y;
+        sumXX += x * x;
+        sumXY += x * y;
+    }
+    double meanX = sumX / n;
+    double meanY = sumY / n;
+    double variance = sumXX / n - meanX * meanX;
+    double lambda = 0.0;
+    if (variance > 1.0e-12)
+        lambda = -(sumXY / n - meanX * meanY) / variance;
+    double timeNow = passTime[numberPoints-1];
+    double passLength = CoinMax((timeNow - passTime[0]) / n, 1.0e-6);
+    double predicted;
+    if (lambda > 1.0e-9) {
+        double exponent = CoinMin(meanY + lambda * (meanX - timeNow), 100.0);
+        predicted = exp(exponent) / lambda * (1.0 - exp(-lambda * passLength));
+    } else {
+        predicted = lastRate * passLength;
+    }
+    double cutoff = getCutoff();
+    double gap;
+    if (cutoff < 1.0e50)
+        gap = cutoff - bound;
+    else
+        gap = CoinMax(fabs(bound), 1.0);
+    if (gap <= 1.0e-12)
+        return false;
+    double fraction = predicted / gap;
+    double timeSoFar = CoinMax(timeNow, 1.0e-3);
+    double returnValue = fraction * timeSoFar / passLength;
+    double threshold = dblParam_[CbcTailingOffReturn];
+    if (returnValue >= threshold)
+        return false;
+    sprintf(explanation, "Root cuts tailing off after pass %d - next pass predicted to gain %g (%.3g%% of %s) in %.2f seconds, return %.3g < %g",
+            currentPassNumber_, predicted, 100.0 * fraction,
+            cutoff < 1.0e50 ? "gap" : "bound", passLength,
+            returnValue, threshold);
+    return true;
+}
+/* Cut selection.
+   Each row cut is scored by efficacy (distance cut off, relative to the
+   best) plus a little for parallelism with the objective less a little
+   for density.  Cuts are then taken greedily by score plus orthogonality
+   to those already taken - any nearly parallel to a chosen cut are
+   dropped.  Infeasible, branch, old and global pool cuts and cuts from
+   generators which must be called again are always kept.
+*/
+int
+CbcModel::selectCuts(OsiCuts & theseCuts, int * whichGenerator)
+{
+    double time1 = CoinCpuTime();
+    int numberCuts = theseCuts.sizeRowCuts();
+    int numberColumns = solver_->getNumCols();
+    const double * solution = solver_->getColSolution();
+    const double * objective = solver_->getObjCoefficients();
+    int maximumCuts = maximumCutsPerRound_;
+    if (maximumCuts <= 0) {
+        if (!numberNodes_)
+            maximumCuts = CoinMax(100, numberRowsAtContinuous_ / 4);
+        else
+            maximumCuts = CoinMax(20, numberRowsAtContinuous_ / 20);
+    }
+    // minimum orthogonality (1.0-cosine) to chosen cuts
+    double minimumOrthogonality = numberNodes_ ? 0.1 : 0.05;
+    double objNorm = 0.0;
+    for (int i = 0; i < numberColumns; i++)
+        objNorm += objective[i] * objective[i];
+    if (objNorm)
+        objNorm = 1.0 / sqrt(objNorm);
+    double * norm = new double [4*numberCuts];
+    double * score = norm + numberCuts;
+    double * extra = score + numberCuts;
+    double * ortho = extra + numberCuts;
+    // 0 candidate, 1 keep, 2 drop
+    char * status = new char [numberCuts];
+    int numberCandidates = 0;
+    double bestEfficacy = 0.0;
+    for (int k = 0; k < numberCuts; k++) {
+        const OsiRowCut * thisCut = theseCuts.rowCutPtr(k);
+        int iGenerator = whichGenerator[k];
+        bool mustKeep = thisCut->lb() > thisCut->ub() || iGenerator < 0 ||
+                        iGenerator >= heldCutGenerator;
+        if (!mustKeep) {
+            iGenerator = iGenerator % 10000;
+            mustKeep = iGenerator >= numberCutGenerators_ ||
+                       generator_[iGenerator]->mustCallAgain();
+        }
+        status[k] = 1;
+        if (mustKeep)
+            continue;
+        int n = thisCut->row().getNumElements();
+        const int * column = thisCut->row().getIndices();
+        const double * element = thisCut->row().getElements();
+        double sum = 0.0;
+        double normThis = 0.0;
+        double obj = 0.0;
+        for (int i = 0; i < n; i++) {
+            int iColumn = column[i];
+            double value = element[i];
+            sum += value * solution[iColumn];
+            normThis += value * value;
+            obj += value * objective[iColumn];
+        }
+        double violation = CoinMax(sum - thisCut->ub(), thisCut->lb() - sum);
+        if (violation <= 1.0e-9 || normThis < 1.0e-20) {
+            // not cutting off solution
+            status[k] = 2;
+            continue;
+        }
+        normThis = 1.0 / sqrt(normThis);
+        norm[k] = normThis;
+        score[k] = violation * normThis;
+        bestEfficacy = CoinMax(bestEfficacy, score[k]);
+        extra[k] = 0.1 * fabs(obj) * normThis * objNorm -
+                   0.1 * static_cast<double> (n) / static_cast<double> (numberColumns);
+        ortho[k] = 1.0;
+        status[k] = 0;
+        numberCandidates++;
+    }
+    for (int k = 0; k < numberCuts; k++) {
+        if (!status[k])
+            score[k] = score[k] / bestEfficacy + extra[k];
+    }
+    int numberChosen = 0;
+    if (numberCandidates) {
+        double * dense = new double [numberColumns];
+        CoinZeroN(dense, numberColumns);
+        while (numberChosen < maximumCuts) {
+            int iBest = -1;
+            double best = -COIN_DBL_MAX;
+            for (int k = 0; k < numberCuts; k++) {
+                if (!status[k] && score[k] + ortho[k] > best) {
+                    best = score[k] + ortho[k];
+                    iBest = k;
+                }
+            }
+            if (iBest < 0)
+                break;
+            status[iBest] = 1;
+            numberChosen++;
+            const OsiRowCut * thisCut = theseCuts.rowCutPtr(iBest);
+            int n = thisCut->row().getNumElements();
+            const int * column = thisCut->row().getIndices();
+            const double * element = thisCut->row().getElements();
+            double normBest = norm[iBest];
+            for (int i = 0; i < n; i++)
+                dense[column[i]] = element[i] * normBest;
+            // sparse dot products with rest
+            for (int k = 0; k < numberCuts; k++) {
+                if (status[k])
+                    continue;
+                const OsiRowCut * thisCut2 = theseCuts.rowCutPtr(k);
+                int n2 = thisCut2->row().getNumElements();
+                const int * column2 = thisCut2->row().getIndices();
+                const double * element2 = thisCut2->row().getElements();
+                double product = 0.0;
+                for (int i = 0; i < n2; i++)
+                    product += element2[i] * dense[column2[i]];
+                double orthoScore = 1.0 - fabs(product) * norm[k];
+                if (orthoScore < minimumOrthogonality)
+                    status[k] = 2;
+                else
+                    ortho[k] = CoinMin(ortho[k], orthoScore);
+            }
+            for (int i = 0; i < n; i++)
+                dense[column[i]] = 0.0;
+        }
+        delete [] dense;
+    }
+    // drop rest and keep whichGenerator in step
+    int numberKept = 0;
+    for (int k = 0; k < numberCuts; k++) {
+        if (status[k] == 1)
+            whichGenerator[numberKept++] = whichGenerator[k];
+    }
+    for (int k = numberCuts - 1; k >= 0; k--) {
+        if (status[k] != 1)
+            theseCuts.eraseRowCut(k);
+    }
+    delete [] norm;
+    delete [] status;
+    numberCutCandidates_ += numberCandidates;
+    numberCutsSelected_ += numberChosen;
+    timeInCutSelection_ += CoinCpuTime() - time1;
+    return numberCuts - numberKept;
+}
 
 /** Solve the model using cuts
 
@@ -7872,6 +9033,7 @@ CbcModel::solveWithCuts (OsiCuts &cuts, int numberTries, CbcNode *node)
 
 
 {
+    CbcProfileTimer cutLoopTimer(profile_, CBC_PROFILE_CUT_LOOP);
 #ifdef JJF_ZERO
     if (node && numberTries > 1) {
         if (currentDepth_ < 5)
@@ -8378,9 +9540,30 @@ CbcModel::solveWithCuts (OsiCuts &cuts, int numberTries, CbcNode *node)
        4) Cut Purging: takeOffCuts() removes inactive cuts from the solver, and
           does the necessary bookkeeping in the model.
     */
+    // for crediting generators with cuts which survive each pass
+    int * cutCredit = numberCutGenerators_ ? new int [2*numberCutGenerators_] : NULL;
+    // ages of cut rows if slack cuts are aged at root (see takeOffCuts)
+    if (!node && !parentModel_ && cutAgeLimit_ > 0) {
+        maximumCutAges_ = CoinMax(1000, solver_->getNumRows() - numberRowsAtContinuous_);
+        cutAge_ = new int [maximumCutAges_];
+        numberCutAges_ = 0;
+    }
+    // time and bound after recent passes for tailing off at root
+    double tailTime[maximumTailPasses];
+    double tailObjective[maximumTailPasses];
+    int numberTailPasses = 0;
+    bool checkTailingOff = !node && !parentModel_ &&
+                           dblParam_[CbcTailingOffReturn] > 0.0;
+    if (checkTailingOff) {
+        tailTime[0] = getCurrentSeconds();
+        tailObjective[0] = lastObjective;
+        numberTailPasses = 1;
+    }
     do {
         currentPassNumber_++ ;
         numberTries-- ;
+        if (cutCredit)
+            countNewCutsByGenerator(cutCredit);
         if (numberTries < 0 && keepGoing) {
             // switch off all normal generators (by the generator's opinion of normal)
             // Intended for situations where the primal problem really isn't complete,
@@ -8429,6 +9612,11 @@ CbcModel::solveWithCuts (OsiCuts &cuts, int numberTries, CbcNode *node)
 		    violation = COIN_DBL_MAX;
 		  //else
 		  //printf("already done??\n");
+		} else if (thisCut->effectiveness() == rootRacingCut) {
+		  // cut from winning root model - add once at root
+		  if (!numberNodes_)
+		    violation = COIN_DBL_MAX;
+		  thisCut->setEffectiveness(0.0);
 		}
 		if (violation > 0.005) {
 		  violations[numberPossible]=-violation;
@@ -8440,7 +9628,8 @@ CbcModel::solveWithCuts (OsiCuts &cuts, int numberTries, CbcNode *node)
 		int k=which[i];
 		OsiRowCut * thisCut = globalCuts_.rowCutPtr(k) ;
 		assert (thisCut->violated(cbcColSolution_) > 0.005/*primalTolerance*/ ||
-			thisCut->effectiveness() == COIN_DBL_MAX);
+			thisCut->effectiveness() == COIN_DBL_MAX ||
+			violations[i] == -COIN_DBL_MAX);
 #define CHECK_DEBUGGER
 #ifdef CHECK_DEBUGGER
 		if ((specialOptions_&1) != 0 && ! parentModel_) {
@@ -8608,9 +9797,11 @@ CbcModel::solveWithCuts (OsiCuts &cuts, int numberTries, CbcNode *node)
                     continue;
                 // see if heuristic will do anything
                 double saveValue = heuristicValue ;
+                CbcProfileTimer heuristicTimer(profile_, CBC_PROFILE_HEURISTIC);
                 int ifSol =
                     heuristic_[i]->solution(heuristicValue,
                                             newSolution);
+                heuristicTimer.stop();
                 //theseCuts) ;
                 if (ifSol > 0) {
                     // better solution found
@@ -8771,6 +9962,9 @@ CbcModel::solveWithCuts (OsiCuts &cuts, int numberTries, CbcNode *node)
             abort();
         }
 #endif
+        // keep best subset of row cuts
+        if (cutSelection() && numberRowCuts > 1)
+            numberRowCuts -= selectCuts(theseCuts, whichGenerator_ + lastNumberCuts);
         int numberToAdd = theseCuts.sizeRowCuts() ;
         numberNewCuts_ = lastNumberCuts + numberToAdd ;
 	// resize whichGenerator
@@ -8802,9 +9996,13 @@ CbcModel::solveWithCuts (OsiCuts &cuts, int numberTries, CbcNode *node)
 		int * whichGenerator = whichGenerator_ + lastNumberCuts;
                 // Faster to add all at once
                 addCuts = new const OsiRowCut * [numberToAdd] ;
+                // (selectCuts has already used whichGenerator)
+                // adaptive frequency credits generators so needs real ones
+                bool keepGenerator = adaptiveCutFrequency();
                 for (i = 0 ; i < numberToAdd ; i++) {
                     addCuts[i] = &theseCuts.rowCut(i) ;
-		    whichGenerator[i]=90;
+		    if (!keepGenerator)
+		      whichGenerator[i]=90;
                 }
                 if ((specialOptions_&262144) != 0 && !parentModel_) {
                     //save
@@ -8831,7 +10029,11 @@ CbcModel::solveWithCuts (OsiCuts &cuts, int numberTries, CbcNode *node)
                 delete basis;
             }
             //solver_->setHintParam(OsiDoDualInResolve,false,OsiHintTry);
+            double timeResolve = CoinCpuTime();
+            numberCutResolves_++;
+            cutResolveRows_ += solver_->getNumRows();
             feasible = ( resolve(node ? node->nodeInfo() : NULL, 2) != 0) ;
+            timeInCutResolves_ += CoinCpuTime() - timeResolve;
             //solver_->setHintParam(OsiDoDualInResolve,true,OsiHintTry);
             if ( maximumSecondsReached() ) {
                 numberTries = -1000; // exit
@@ -8900,6 +10102,8 @@ CbcModel::solveWithCuts (OsiCuts &cuts, int numberTries, CbcNode *node)
                 numberRowsAtStart = numberOldActiveCuts_ + numberRowsAtContinuous_ ;
                 lastNumberCuts = numberNewCuts_ ;
                 double thisObj = direction * solver_->getObjValue();
+                if (cutCredit && cut_obj[CUT_HISTORY-1] > -1.0e50)
+                    creditCutGenerators(cutCredit, thisObj - cut_obj[CUT_HISTORY-1]);
                 bool badObj = (allowZeroIterations) ? thisObj < cut_obj[0] + minimumDrop
                               : thisObj < cut_obj[CUT_HISTORY-1] + minimumDrop;
 #ifdef JJF_ZERO // probably not a good idea
@@ -8997,6 +10201,24 @@ CbcModel::solveWithCuts (OsiCuts &cuts, int numberTries, CbcNode *node)
                     else
                         numberLastAttempts++;
                 }
+                if (checkTailingOff && numberTries > 0 && !keepGoing) {
+                    if (numberTailPasses == maximumTailPasses) {
+                        for (int j = 0; j < maximumTailPasses - 1; j++) {
+                            tailTime[j] = tailTime[j+1];
+                            tailObjective[j] = tailObjective[j+1];
+                        }
+                        numberTailPasses--;
+                    }
+                    tailTime[numberTailPasses] = getCurrentSeconds();
+                    tailObjective[numberTailPasses++] = thisObj;
+                    char explanation[200];
+                    if (tailingOff(tailTime, tailObjective, numberTailPasses,
+                                   explanation)) {
+                        numberTries = 0;
+                        messageHandler()->message(CBC_GENERAL, messages())
+                        << explanation << CoinMessageEol ;
+                    }
+                }
                 if (numberTries > 0) {
                     reducedCostFix() ;
                     lastObjective = direction * solver_->getObjValue() ;
@@ -9038,6 +10260,11 @@ CbcModel::solveWithCuts (OsiCuts &cuts, int numberTries, CbcNode *node)
 	  }
 	}
     } while (numberTries > 0 || keepGoing) ;
+    delete [] cutCredit;
+    delete [] cutAge_;
+    cutAge_ = NULL;
+    numberCutAges_ = 0;
+    maximumCutAges_ = 0;
     /*
       End cut generation loop.
     */
@@ -9161,8 +10388,10 @@ CbcModel::solveWithCuts (OsiCuts &cuts, int numberTries, CbcNode *node)
                     continue;
                 // see if heuristic will do anything
                 double saveValue = heuristicValue ;
+                CbcProfileTimer heuristicTimer(profile_, CBC_PROFILE_HEURISTIC);
                 int ifSol = heuristic_[i]->solution(heuristicValue,
                                                     newSolution);
+                heuristicTimer.stop();
                 if (ifSol > 0) {
                     // better solution found
                     heuristic_[i]->incrementNumberSolutionsFound();
@@ -9858,6 +11087,8 @@ CbcModel::solveWithCuts (OsiCuts &cuts, int numberTries, CbcNode *node)
                         generator_[iGenerator]->incrementNumberCutsActive();
                 }
             }
+            if (node && adaptiveCutFrequency())
+                adaptCutGenerators();
         }
     }
 
@@ -10147,15 +11378,21 @@ CbcModel::serialCuts(OsiCuts & theseCuts, CbcNode * node, OsiCuts & slackCuts, i
         // delete null cuts
         int nCuts = theseCuts.sizeRowCuts() ;
         int k ;
+        int * whichGenerator = whichGenerator_ + lastNumberCuts;
         for (k = nCuts - 1; k >= 0; k--) {
             const OsiRowCut * thisCut = theseCuts.rowCutPtr(k) ;
             int n = thisCut->row().getNumElements();
-            if (!n)
+            if (!n) {
                 theseCuts.eraseRowCut(k);
+                // keep whichGenerator in step
+                nCuts--;
+                for (int j = k; j < nCuts; j++)
+                    whichGenerator[j] = whichGenerator[j+1];
+            }
         }
     }
-    // Add in any violated saved cuts
-    if (!theseCuts.sizeRowCuts() && !theseCuts.sizeColCuts()) {
+    // Add in any violated saved cuts (every pass if aging)
+    if ((!theseCuts.sizeRowCuts() && !theseCuts.sizeColCuts()) || cutAge_) {
         int numberOld = theseCuts.sizeRowCuts() + lastNumberCuts;
         int numberCuts = slackCuts.sizeRowCuts() ;
         int i;
@@ -10169,8 +11406,10 @@ CbcModel::serialCuts(OsiCuts & theseCuts, CbcNode * node, OsiCuts & slackCuts, i
                 if (messageHandler()->logLevel() > 2)
                     printf("Old cut added - violation %g\n",
                            thisCut->violated(cbcColSolution_)) ;
-                whichGenerator_[numberOld++] = 20097;
+                whichGenerator_[numberOld++] = heldCutGenerator;
                 theseCuts.insert(*thisCut) ;
+                if (cutAge_)
+                    numberHeldCutsAdded_++;
             }
         }
     }
@@ -10243,6 +11482,46 @@ CbcModel::takeOffCuts (OsiCuts &newCuts,
     if (clpSolver)
       problemStatus=clpSolver->getModelPtr()->status();
 #endif
+    /*
+      If aging, a cut is only taken off when it has been slack for
+      cutAgeLimit_ consecutive calls and then only when enough cuts are
+      that old to make it worth compacting the rows.  Until then slack cuts
+      stay in the solver.  minimumAge is the age a cut must have to go.
+    */
+    int minimumAge = 0;
+    if (cutAge_) {
+        if (totalNumberCuts < numberCutAges_) {
+            // rows taken off elsewhere - start again
+            numberCutAges_ = 0;
+        }
+        if (totalNumberCuts > maximumCutAges_) {
+            maximumCutAges_ = CoinMax(2 * maximumCutAges_, totalNumberCuts);
+            int * temp = new int [maximumCutAges_];
+            CoinMemcpyN(cutAge_, numberCutAges_, temp);
+            delete [] cutAge_;
+            cutAge_ = temp;
+        }
+        // new cuts have not been slack yet
+        for (int i = numberCutAges_; i < totalNumberCuts; i++)
+            cutAge_[i] = 0;
+        numberCutAges_ = totalNumberCuts;
+        ws = dynamic_cast<const CoinWarmStartBasis*>(solver_->getWarmStart()) ;
+        int numberOld = 0;
+        for (int i = 0; i < totalNumberCuts; i++) {
+            if (ws->getArtifStatus(i + firstOldCut) == CoinWarmStartBasis::basic) {
+                cutAge_[i]++;
+                if (cutAge_[i] >= cutAgeLimit_)
+                    numberOld++;
+            } else {
+                cutAge_[i] = 0;
+            }
+        }
+        delete ws;
+        int batch = cutDeletionBatch_;
+        if (!batch)
+            batch = CoinMax(10, numberRowsAtContinuous_ / 20);
+        minimumAge = (numberOld >= batch) ? cutAgeLimit_ : COIN_INT_MAX;
+    }
     bool needPurge = true ;
     /*
       The outer loop allows repetition of purge in the event that reoptimisation
@@ -10271,6 +11550,7 @@ CbcModel::takeOffCuts (OsiCuts &newCuts,
                 assert(oldCutIndex < currentNumberCuts_) ;
                 // always leave if from nextRowCut_
                 if (status == CoinWarmStartBasis::basic &&
+                        (!cutAge_ || cutAge_[i] >= minimumAge) &&
                         (addedCuts_[oldCutIndex]->effectiveness() <= 1.0e10 ||
                          addedCuts_[oldCutIndex]->canDropCut(solver_, i + firstOldCut))) {
                     solverCutIndices[numberOldToDelete++] = i + firstOldCut ;
@@ -10309,6 +11589,7 @@ CbcModel::takeOffCuts (OsiCuts &newCuts,
         for (i = 0 ; i < nCuts ; i++) {
             status = ws->getArtifStatus(i + firstNewCut) ;
             if (status == CoinWarmStartBasis::basic &&
+                    (!cutAge_ || cutAge_[i + firstNewCut - firstOldCut] >= minimumAge) &&
                     /*whichGenerator_[i]!=-2*/newCuts.rowCutPtr(i)->effectiveness() < 1.0e20) {
                 solverCutIndices[numberNewToDelete+numberOldToDelete] = i + firstNewCut ;
                 newCutIndices[numberNewToDelete++] = i ;
@@ -10323,6 +11604,7 @@ CbcModel::takeOffCuts (OsiCuts &newCuts,
         for (i = 0 ; i < numberNewCuts ; i++) {
             status = ws->getArtifStatus(i + baseRow) ;
             if (status != CoinWarmStartBasis::basic ||
+                    (cutAge_ && cutAge_[i + baseRow - firstOldCut] < minimumAge) ||
                     /*whichGenerator_[i+nCuts]==-2*/addedCuts[i]->effectiveness() >= 1.0e20) {
                 newCuts.insert(*addedCuts[i]) ;
                 //newCuts.insert(mutableAdded[i]) ;
@@ -10367,6 +11649,21 @@ CbcModel::takeOffCuts (OsiCuts &newCuts,
             numberNewCuts_ -= numberNewToDelete ;
             assert (numberNewCuts_ == newCuts.sizeRowCuts());
             numberOldActiveCuts_ -= numberOldToDelete ;
+            if (cutAge_) {
+                // keep ages in step (solverCutIndices are increasing)
+                int n = 0;
+                int k = 0;
+                for (i = 0; i < numberCutAges_; i++) {
+                    if (k < numberTotalToDelete &&
+                            solverCutIndices[k] == i + firstOldCut)
+                        k++;
+                    else
+                        cutAge_[n++] = cutAge_[i];
+                }
+                numberCutAges_ = n;
+                numberAgedCutsDeleted_ += numberTotalToDelete;
+                numberCutDeletionBatches_++;
+            }
 #     ifdef CBC_DEBUG
             printf("takeOffCuts: purged %d+%d cuts\n", numberOldToDelete,
                    numberNewToDelete );
@@ -12316,6 +13613,138 @@ void CbcModel::setCutoff (double value)
 
 
 
+/*
+  Quick check of a candidate without an LP.  Only done when all objects are
+  simple integers (so rounding is all feasibleRegion would do).  Tolerances
+  are tight as there is no LP to clean up afterwards - anything doubtful
+  goes through the full check.  Continuous variables are taken as they
+  are, so unlike the full check they are not polished by an LP with the
+  integers fixed and the objective may be a little worse than it could be.
+*/
+bool
+CbcModel::quickCheckSolution(double * solution, double & objectiveValue)
+{
+    OsiSolverInterface * solver = continuousSolver_ ? continuousSolver_ : solver_;
+    if (numberObjects_ != numberIntegers_ || (moreSpecialOptions2_&4) != 0)
+        return false;
+    for (int i = 0; i < numberObjects_; i++) {
+        if (!dynamic_cast<CbcSimpleInteger *> (object_[i]))
+            return false;
+    }
+    int numberColumns = solver->getNumCols();
+    int numberRows = solver->getNumRows();
+    double integerTolerance = getIntegerTolerance();
+    double primalTolerance;
+    solver->getDblParam(OsiPrimalTolerance, primalTolerance) ;
+    const double * columnLower = solver->getColLower();
+    const double * columnUpper = solver->getColUpper();
+    double * candidate = CoinCopyOfArray(solution, numberColumns);
+    bool feasible = true;
+    for (int i = 0; i < numberIntegers_; i++) {
+        int iColumn = integerVariable_[i];
+        double value = candidate[iColumn];
+        double nearest = floor(value + 0.5);
+        if (fabs(value - nearest) > integerTolerance) {
+            feasible = false;
+            break;
+        }
+        candidate[iColumn] = nearest;
+    }
+    for (int iColumn = 0; iColumn < numberColumns && feasible; iColumn++) {
+        double value = candidate[iColumn];
+        if (value < columnLower[iColumn] - primalTolerance ||
+                value > columnUpper[iColumn] + primalTolerance)
+            feasible = false;
+        value = CoinMax(value, columnLower[iColumn]);
+        candidate[iColumn] = CoinMin(value, columnUpper[iColumn]);
+    }
+    if (!feasible) {
+        delete [] candidate;
+        return false;
+    }
+    /*
+      Row activities - update those of last candidate if only a few
+      columns differ (refresh now and then so errors do not build up).
+    */
+    const CoinPackedMatrix * matrix = solver->getMatrixByCol();
+    const double * element = matrix->getElements();
+    const int * row = matrix->getIndices();
+    const CoinBigIndex * columnStart = matrix->getVectorStarts();
+    const int * columnLength = matrix->getVectorLengths();
+    bool fromScratch = true;
+    if (checkActivity_ && checkNumberRows_ == numberRows &&
+            checkNumberColumns_ == numberColumns && checkUpdates_ < 100) {
+        int numberDifferent = 0;
+        int maximumDifferent = numberColumns / 8;
+        for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+            if (candidate[iColumn] != checkReference_[iColumn]) {
+                numberDifferent++;
+                if (numberDifferent > maximumDifferent)
+                    break;
+            }
+        }
+        if (numberDifferent <= maximumDifferent) {
+            fromScratch = false;
+            for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+                double change = candidate[iColumn] - checkReference_[iColumn];
+                if (change) {
+                    CoinBigIndex start = columnStart[iColumn];
+                    CoinBigIndex end = start + columnLength[iColumn];
+                    for (CoinBigIndex j = start; j < end; j++)
+                        checkActivity_[row[j]] += change * element[j];
+                }
+            }
+            checkUpdates_++;
+        }
+    }
+    if (fromScratch) {
+        if (checkNumberRows_ != numberRows || !checkActivity_) {
+            delete [] checkActivity_;
+            checkActivity_ = new double [numberRows];
+            checkNumberRows_ = numberRows;
+        }
+        if (checkNumberColumns_ != numberColumns || !checkReference_) {
+            delete [] checkReference_;
+            checkReference_ = new double [numberColumns];
+            checkNumberColumns_ = numberColumns;
+        }
+        memset(checkActivity_, 0, numberRows*sizeof(double));
+        for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+            double value = candidate[iColumn];
+            if (value) {
+                CoinBigIndex start = columnStart[iColumn];
+                CoinBigIndex end = start + columnLength[iColumn];
+                for (CoinBigIndex j = start; j < end; j++)
+                    checkActivity_[row[j]] += value * element[j];
+            }
+        }
+        checkUpdates_ = 0;
+    }
+    memcpy(checkReference_, candidate, numberColumns*sizeof(double));
+    const double * rowLower = solver->getRowLower();
+    const double * rowUpper = solver->getRowUpper();
+    for (int iRow = 0; iRow < numberRows; iRow++) {
+        double value = checkActivity_[iRow];
+        if (value > rowUpper[iRow] + primalTolerance*(1.0 + fabs(rowUpper[iRow])) ||
+                value < rowLower[iRow] - primalTolerance*(1.0 + fabs(rowLower[iRow]))) {
+            feasible = false;
+            break;
+        }
+    }
+    if (feasible) {
+        double offset;
+        solver->getDblParam(OsiObjOffset, offset);
+        const double * objective = solver->getObjCoefficients();
+        double objValue = -offset;
+        for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+            objValue += candidate[iColumn] * objective[iColumn];
+        objectiveValue = objValue * solver->getObjSense();
+        memcpy(solution, candidate, numberColumns*sizeof(double));
+    }
+    delete [] candidate;
+    return feasible;
+}
+
 /*
   Call this to really test if a valid solution can be feasible. The cutoff is
   passed in as a parameter so that we don't need to worry here after swapping
@@ -12337,6 +13766,21 @@ CbcModel::checkSolution (double cutoff, double *solution,
 {
     int numberContinuousColumns=continuousSolver_->getNumCols();
     if (!solverCharacteristics_->solutionAddsCuts()) {
+        /*
+          Most candidates are feasible as they stand - then there is
+          no need to save and fix bounds and solve an LP.  The LP is only
+          there to repair continuous variables.
+        */
+        numberSolutionChecks_++;
+        if (fixVariables <= 0 && (specialOptions_&16) == 0 &&
+                quickCheckSolution(solution, objectiveValue)) {
+            numberQuickChecks_++;
+            // as after full check - basis saved was for old solution
+            bestSolutionBasis_ = CoinWarmStartBasis();
+            if (objectiveValue > cutoff && objectiveValue < cutoff + 1.0e-8 + 1.0e-8*fabs(cutoff))
+                cutoff = objectiveValue; // relax
+            return (objectiveValue <= cutoff) ? objectiveValue : 1.0e50;
+        }
         // Can trust solution
         int numberColumns = solver_->getNumCols();
 #ifdef COIN_HAS_CLP
@@ -14595,6 +16039,7 @@ void CbcModel::passInEventHandler (const CbcEventHandler *eventHandler)
 int
 CbcModel::resolve(OsiSolverInterface * solver)
 {
+    CbcProfileTimer resolveTimer(profile_, CBC_PROFILE_RESOLVE);
     numberSolves_++;
 #ifdef COIN_HAS_CLP
     OsiClpSolverInterface * clpSolver
@@ -15915,8 +17360,10 @@ CbcModel::doHeuristicsAtRoot(int deleteHeuristicsAfterwards)
                     // see if heuristic will do anything
                     double saveValue = heuristicValue ;
 		    double before = getCurrentSeconds();
+                    CbcProfileTimer heuristicTimer(profile_, CBC_PROFILE_HEURISTIC);
                     int ifSol = heuristic_[i]->solution(heuristicValue,
                                                         newSolution);
+                    heuristicTimer.stop();
 		    if (handler_->logLevel()>1) {
 		      char line[100];
 		      sprintf(line,"Heuristic %s took %g seconds (%s)",
@@ -16094,6 +17541,13 @@ CbcModel::zapIntegerInformation(bool leaveObjects)
         object_ = NULL;
     }
 }
+// Create C++ lines (and statistics) to tune cut generators
+void
+CbcModel::generateTuning( FILE * fp)
+{
+    for (int i = 0; i < numberCutGenerators_; i++)
+        generator_[i]->generateTuning(fp);
+}
 // Create C++ lines to get to current state
 void
 CbcModel::generateCpp( FILE * fp, int /*options*/)
@@ -16304,8 +17758,28 @@ CbcModel::doOneNode(CbcModel * baseModel, CbcNode * & node, CbcNode * & newNode)
 	numberCutGenerators_=0; // so can dive and branch
     }
     currentNode_ = node; // so can be accessed elsewhere
+    CbcProfileTimer nodeTimer(profile_, CBC_PROFILE_NODE);
     double bestObjective = bestObjective_;
     numberUpdateItems_ = 0;
+    // for node trace (not from sub-models)
+    CbcNodeTrace * trace = parentModel_ ? NULL : nodeTrace_;
+    double traceStart = 0.0;
+    int traceNode = -1;
+    int traceParent = -1;
+    int traceDepth = node->depth();
+    int traceIterations = numberIterations_;
+    int traceCuts = 0;
+    double traceObjective = COIN_DBL_MAX;
+    // NODE only recorded if LP solved; prune reason taken before strong branching
+    bool traceSolved = false;
+    int traceReason = CBC_TRACE_CUTOFF;
+    if (trace) {
+        traceStart = trace->seconds();
+        CbcNodeInfo * nodeInfo = node->nodeInfo();
+        traceNode = nodeInfo->nodeNumber();
+        if (nodeInfo->parent())
+            traceParent = nodeInfo->parent()->nodeNumber();
+    }
     // Say not on optimal path
     bool onOptimalPath = false;
 #   ifdef CHECK_NODE
@@ -16418,6 +17892,46 @@ CbcModel::doOneNode(CbcModel * baseModel, CbcNode * & node, CbcNode * & newNode)
             node->nodeInfo()->increment() ;
             unlockThread();
         }
+        /*
+          Propagate the branch through the original rows. Any tightening is
+          picked up by createInfo (it compares against lowerBefore/upperBefore)
+          and if the node is infeasible we need not solve the LP.
+        */
+        CbcProfileTimer propagationTimer((propagation_ || conflicts_) ? profile_ : NULL,
+                                         CBC_PROFILE_PROPAGATION);
+        if (propagation_ && propagation_->numberRows() == numberRowsAtContinuous_) {
+            if (propagation_->propagate(solver_, lowerBefore, upperBefore) < 0) {
+                feasible = false;
+                numberInfeasibleNodes_++;
+                traceReason = CBC_TRACE_INFEASIBLE;
+                if (conflicts_) {
+                    // learn why
+                    int maximumLength = conflicts_->maximumLength();
+                    int * column = new int [maximumLength];
+                    double * bound = new double [maximumLength];
+                    char * isUpper = new char [maximumLength];
+                    int numberLiterals = propagation_->conflict(column, bound, isUpper,
+                                         maximumLength);
+                    conflicts_->addConflict(numberLiterals, column, bound, isUpper);
+                    delete [] column;
+                    delete [] bound;
+                    delete [] isUpper;
+                }
+            }
+        }
+        /*
+          If all bounds of a learned conflict hold then the node can not
+          contain anything better than the cutoff.
+        */
+        if (feasible && conflicts_ &&
+                conflicts_->prune(solver_->getColLower(), solver_->getColUpper(),
+                                  lowerBefore, upperBefore)) {
+            feasible = false;
+            numberInfeasibleNodes_++;
+        }
+        propagationTimer.stop();
+        // so we only learn from nodes where LP was solved
+        bool solvingNode = feasible;
         if ((specialOptions_&1) != 0) {
             /*
             This doesn't work as intended --- getRowCutDebugger will return null
@@ -16435,12 +17949,27 @@ CbcModel::doOneNode(CbcModel * baseModel, CbcNode * & node, CbcNode * & newNode)
         /*
           Reoptimize, possibly generating cuts and/or using heuristics to find
           solutions.  Cut reference counts are unaffected unless we lose feasibility,
-          in which case solveWithCuts() will make the adjustment.
+          in which case solveWithCuts() will make the adjustment.  If propagation
+          or a conflict has already lost feasibility solveWithCuts() is not called
+          so do it here.
         */
         phase_ = 2;
         OsiCuts cuts ;
         int saveNumber = numberIterations_;
-        if (solverCharacteristics_->solutionAddsCuts()) {
+        if (!feasible) {
+            // found infeasible by propagation or a conflict - take cuts off node
+            if (currentNumberCuts_) {
+                lockThread();
+                for (int i = 0; i < currentNumberCuts_; i++) {
+                    if (addedCuts_[i]) {
+                        if (!addedCuts_[i]->decrement())
+                            delete addedCuts_[i] ;
+                        addedCuts_[i] = NULL ;
+                    }
+                }
+                unlockThread();
+            }
+        } else if (solverCharacteristics_->solutionAddsCuts()) {
             int returnCode = resolve(node ? node->nodeInfo() : NULL, 1);
             feasible = returnCode != 0;
             if (feasible) {
@@ -16835,6 +18364,17 @@ CbcModel::doOneNode(CbcModel * baseModel, CbcNode * & node, CbcNode * & newNode)
             feasible = solveWithCuts(cuts, maximumCutPasses_, node);
 #endif
         }
+        if (trace && solvingNode) {
+            traceSolved = true;
+            if (!feasible && solver_->isProvenPrimalInfeasible())
+                traceReason = CBC_TRACE_INFEASIBLE;
+        }
+        if (!feasible && solvingNode && conflicts_ && !eventHappened_ &&
+                !solver_->isAbandoned()) {
+            // infeasible or cut off - keep bounds if few changed from root
+            // (ignored unless all objects simple integers)
+            conflicts_->addNodeConflict(solver_);
+        }
         if ((specialOptions_&1) != 0 && onOptimalPath) {
 	    if(solver_->getRowCutDebuggerAlways()->optimalValue()<getCutoff()) {
 	        if (!solver_->getRowCutDebugger() || !feasible) {
@@ -17247,6 +18787,19 @@ CbcModel::doOneNode(CbcModel * baseModel, CbcNode * & node, CbcNode * & newNode)
         if (eventHandler_ && !eventHandler_->event(CbcEventHandler::node)) {
             eventHappened_ = true; // exit
         }
+        // for tree size estimate
+        if (!newNode || !newNode->active() || !newNode->branchingObject())
+            recordTreeLeaf(node->depth() + 1);
+        if (trace) {
+            traceCuts = cuts.sizeRowCuts();
+            if (newNode && newNode->active()) {
+                traceObjective = newNode->objectiveValue();
+            } else {
+                trace->record(nodeTraceThread_, CBC_TRACE_PRUNE, traceNode,
+                              traceParent, traceDepth + 1, traceReason, 0,
+                              traceObjective);
+            }
+        }
         if (parallelMode() >= 0)
             assert (!newNode || newNode->objectiveValue() <= getCutoff()) ;
         else
@@ -17325,6 +18878,15 @@ CbcModel::doOneNode(CbcModel * baseModel, CbcNode * & node, CbcNode * & newNode)
                     << numberNodes_ << newNode->objectiveValue()
                     << newNode->numberUnsatisfied() << newNode->depth()
                     << CoinMessageEol ;
+                    if (trace) {
+                        const CbcBranchingObject * branch =
+                            dynamic_cast<const CbcBranchingObject *> (newNode->branchingObject());
+                        trace->record(nodeTraceThread_, CBC_TRACE_BRANCH,
+                                      newNode->nodeInfo()->nodeNumber(), traceNode,
+                                      newNode->depth(), branch ? branch->variable() : -1,
+                                      newNode->numberUnsatisfied(),
+                                      newNode->objectiveValue());
+                    }
                     // Increment cut counts (taking off current)
                     int numberLeft = newNode->numberBranches() ;
                     for (i = 0; i < currentNumberCuts_; i++) {
@@ -17351,7 +18913,15 @@ CbcModel::doOneNode(CbcModel * baseModel, CbcNode * & node, CbcNode * & newNode)
                         if (!heuristic_[iHeur]->shouldHeurRun(whereFrom))
                             continue;
                         double saveValue = heurValue ;
+                        double traceHeuristic = trace ? trace->seconds() : 0.0;
+                        CbcProfileTimer heuristicTimer(profile_, CBC_PROFILE_HEURISTIC);
                         int ifSol = heuristic_[iHeur]->solution(heurValue, newSolution) ;
+                        heuristicTimer.stop();
+                        if (trace)
+                            trace->record(nodeTraceThread_, CBC_TRACE_HEURISTIC,
+                                          traceNode, traceParent, traceDepth + 1,
+                                          iHeur, ifSol > 0 ? 1 : 0, heurValue,
+                                          trace->seconds() - traceHeuristic);
                         if (ifSol > 0) {
                             // new solution found
                             heuristic_[iHeur]->incrementNumberSolutionsFound();
@@ -17425,6 +18995,10 @@ CbcModel::doOneNode(CbcModel * baseModel, CbcNode * & node, CbcNode * & newNode)
                     }
                     double objectiveValue = newNode->objectiveValue();
                     lastHeuristic_ = NULL;
+                    if (trace)
+                        trace->record(nodeTraceThread_, CBC_TRACE_PRUNE, traceNode,
+                                      traceParent, traceDepth + 1, CBC_TRACE_INTEGER,
+                                      0, objectiveValue);
                     // Just possible solver did not know about a solution from another thread!
                     if (objectiveValue < getCutoff()) {
                         incrementUsed(solver_->getColSolution());
@@ -17509,6 +19083,10 @@ CbcModel::doOneNode(CbcModel * baseModel, CbcNode * & node, CbcNode * & newNode)
 #endif
         //abort();
         assert (node->nodeInfo());
+        if (trace)
+            trace->record(nodeTraceThread_, CBC_TRACE_PRUNE, traceNode,
+                          traceParent, traceDepth + 1, CBC_TRACE_CUTOFF, 0,
+                          traceObjective);
         if (parallelMode() >= 0) {
             if (!node->nodeInfo()->numberBranchesLeft())
                 node->nodeInfo()->allBranchesGone(); // can clean up
@@ -17554,6 +19132,7 @@ CbcModel::doOneNode(CbcModel * baseModel, CbcNode * & node, CbcNode * & newNode)
         }
         if (bestObjective_ < baseModel->bestObjective_ && bestObjective_ < baseModel->getCutoff()) {
             baseModel->bestObjective_ = bestObjective_ ;
+            baseModel->addTimelinePoint();
             int numberColumns = solver_->getNumCols();
             if (!baseModel->bestSolution_)
                 baseModel->bestSolution_ = new double[numberColumns];
@@ -17569,6 +19148,10 @@ CbcModel::doOneNode(CbcModel * baseModel, CbcNode * & node, CbcNode * & newNode)
         baseModel->numberSolutions_++;
         unlockThread();
     }
+    if (traceSolved)
+        trace->record(nodeTraceThread_, CBC_TRACE_NODE, traceNode, traceParent,
+                      traceDepth, numberIterations_ - traceIterations, traceCuts,
+                      traceObjective, trace->seconds() - traceStart);
     numberCutGenerators_=saveNumberCutGenerators;
     return foundSolution;
 }
@@ -17827,6 +19410,56 @@ CbcModel::canStopOnGap() const
 #endif
   return returnCode;
 }
+/* Record a leaf for weighted backtrack estimate.  A leaf at depth d
+   is reached by a random dive with probability 2**-d and implies a tree
+   of 2**(d+1)-1 nodes if the tree were balanced. */
+void
+CbcModel::recordTreeLeaf(int depth)
+{
+    double weight = ldexp(1.0, -CoinMin(depth, 1000));
+    treeLeafWeight_ += weight;
+    treeLeafSum_ += 2.0 - weight; // weight*(2**(d+1)-1)
+}
+// Update tree size and time to completion estimates
+void
+CbcModel::updateTreeEstimate()
+{
+    double now = getCurrentSeconds();
+    int nNodes = tree_ ? tree_->size() : 0;
+    double secondsLeft = -1.0;
+    if (treeLeafWeight_ > 0.0) {
+        double estimate = treeLeafSum_ / treeLeafWeight_;
+        // can't be smaller than what we have seen
+        estimate = CoinMax(estimate, static_cast<double>(numberNodes_ + nNodes));
+        estimatedTreeNodes_ = estimate;
+        if (treeStartSeconds_ < 0.0) {
+            treeStartSeconds_ = now;
+            treeStartNodes_ = numberNodes_;
+        } else if (numberNodes_ > treeStartNodes_) {
+            double perNode = (now - treeStartSeconds_) /
+                             static_cast<double>(numberNodes_ - treeStartNodes_);
+            secondsLeft = perNode * (estimate - numberNodes_);
+        }
+    }
+    // search also ends when gap closes - extrapolate rate of closure
+    if (bestObjective_ < 1.0e50 && bestPossibleObjective_ > -1.0e50) {
+        double gap = CoinMax(bestObjective_ - bestPossibleObjective_, 0.0) /
+                     CoinMax(fabs(bestObjective_), 1.0e-5);
+        if (gapStartTime_ < 0.0) {
+            gapStartTime_ = now;
+            gapStart_ = gap;
+        } else if (gap < gapStart_ && now > gapStartTime_) {
+            double rate = (gapStart_ - gap) / (now - gapStartTime_);
+            double gapSeconds =
+                CoinMax(gap - dblParam_[CbcAllowableFractionGap], 0.0) / rate;
+            if (secondsLeft < 0.0)
+                secondsLeft = gapSeconds;
+            else
+                secondsLeft = CoinMin(secondsLeft, gapSeconds);
+        }
+    }
+    estimatedSecondsLeft_ = secondsLeft;
+}
 // Adjust heuristics based on model
 void
 CbcModel::adjustHeuristics()
@@ -17952,6 +19585,7 @@ CbcModel::saveBestSolution(const double * solution, double objectiveValue)
         bestSolution_ = new double [n];
     bestObjective_ = objectiveValue;
     memcpy(bestSolution_, solution, n*sizeof(double));
+    addTimelinePoint();
 }
 // Delete best and saved solutions
 void
@@ -18271,8 +19905,10 @@ CbcModel::integerPresolveThisModel(OsiSolverInterface * originalSolver,
                     if (!heuristic_[iHeuristic]->shouldHeurRun(whereFrom))
                         continue;
                     double saveValue = heuristicValue;
+                    CbcProfileTimer heuristicTimer(profile_, CBC_PROFILE_HEURISTIC);
                     int ifSol = heuristic_[iHeuristic]->solution(heuristicValue,
                                 newSolution);
+                    heuristicTimer.stop();
                     if (ifSol > 0) {
                         // better solution found
                         heuristic_[iHeuristic]->incrementNumberSolutionsFound();
@@ -18600,7 +20236,16 @@ CbcModel::preProcess( int makeEquality, int numberPasses, int tuning)
     generator1.setMaxLookRoot(50);
     generator1.setRowCuts(3);
     // Add in generators
-    process->addCutGenerator(&generator1);
+    double maximumSeconds = dblParam_[CbcPreProcessSeconds];
+    // plain CglProbing lets CglPreProcess strengthen coefficients
+    if (CbcPreProcessProbing::wanted(*solver_, maximumSeconds, numberThreads_)) {
+        // budgeted and threaded probing
+        CbcPreProcessProbing budgetProbing(generator1, this, maximumSeconds,
+                                           CoinMax(numberThreads_, 1));
+        process->addCutGenerator(&budgetProbing);
+    } else {
+        process->addCutGenerator(&generator1);
+    }
     process->messageHandler()->setLogLevel(this->logLevel());
     /* model may not have created objects
        If none then create
@@ -18649,6 +20294,13 @@ CbcModel::preProcess( int makeEquality, int numberPasses, int tuning)
                                      numberPasses, tuning);
     // Tell solver we are not in Branch and Cut
     solver_->setHintParam(OsiDoInBranchAndCut, false, OsiHintDo) ;
+    // process has its own copy of generator
+    for (int iGenerator = 0; iGenerator < process->numberCutGenerators(); iGenerator++) {
+        CbcPreProcessProbing * budgetProbing =
+            dynamic_cast<CbcPreProcessProbing *> (process->cutGenerator(iGenerator));
+        if (budgetProbing)
+            budgetProbing->report();
+    }
     if (newSolver) {
         int numberOriginalObjects = numberObjects_;
         OsiSolverInterface * originalSolver = solver_;
@@ -19219,7 +20871,14 @@ static void * doRootCbcThread(void * voidInfo)
       int logLevel=simplex->logLevel();
       if (logLevel<=1)
 	simplex->setLogLevel(0);
-      simplex->dual();
+      // racing may ask for primal
+      bool takeHint;
+      OsiHintStrength strength;
+      clpSolver->getHintParam(OsiDoDualInInitial, takeHint, strength);
+      if (!takeHint && strength == OsiHintDo)
+	simplex->primal();
+      else
+	simplex->dual();
       simplex->setLogLevel(logLevel);
       clpSolver->setWarmStart(NULL);
     } else {
@@ -28,6 +28,11 @@ class CglCutGenerator;
 class CglStored;
 class CbcCutModifier;
 class CglTreeProbingInfo;
+class CbcPropagation;
+class CbcConflictStore;
+class CbcModelCache;
+class CbcNodeTrace;
+class CbcProfile;
 class CbcHeuristic;
 class OsiObject;
 class CbcThread;
@@ -124,6 +129,9 @@ public:
         /** Number of branches (may be more than number of nodes as may
             include strong branching) */
         CbcNumberBranches,
+        /** Work units (simplex iterations plus two per node) each thread does
+            between merges in deterministic parallel mode - 0 gives default */
+        CbcDeterministicWorkUnits,
         /** Just a marker, so that a static sized array can store parameters. */
         CbcLastIntParam
     };
@@ -190,6 +198,27 @@ public:
         CbcLargestChange,
         /// Small non-zero change on a branch to be used as guess
         CbcSmallChange,
+        /** Time budget (seconds) for racing multiple root tries.
+            If positive the multiple root models are diversified (seed, LP
+            algorithm, cut passes), stopped after this time and scored on
+            dual bound, fractionality and incumbent.  The winner's cuts,
+            pseudocosts and (if compatible) basis seed the main search while
+            the other models' cuts just go into the global pool.
+        */
+        CbcRootRacingSeconds,
+        /** Wall clock budget (seconds) for probing in preprocessing.
+            If positive, or if there are threads, probing is done by
+            CbcPreProcessProbing and passes after the budget is used make
+            no changes so preprocessing stops.
+        */
+        CbcPreProcessSeconds,
+        /** Tailing off at root.  If positive the root cut loop fits the
+            bound against time over recent passes and stops when the
+            predicted fraction of gap closed by another pass, divided by
+            the fraction of time so far that pass would take, is less
+            than this.  0.0 (default) leaves the normal tests alone.
+        */
+        CbcTailingOffReturn,
         /** Just a marker, so that a static sized array can store parameters. */
         CbcLastDblParam
     };
@@ -252,6 +281,29 @@ private:
                             int & numberNodesOutput, int & status) ;
     /// Update size of whichGenerator
     void resizeWhichGenerator(int numberNow, int numberAfter);
+    /// Count new cuts in solver by generator (count has numberCutGenerators_)
+    void countNewCutsByGenerator(int * count) const;
+    /** Credit generators with cuts which stayed in after a pass and
+        share objective change of pass between them.
+        count has cuts before pass (from countNewCutsByGenerator) and
+        is used as work array (2*numberCutGenerators_) */
+    void creditCutGenerators(int * count, double objectiveChange);
+    /// Adaptive control of cut generator frequency in tree
+    void adaptCutGenerators();
+    /** See if root cut loop is tailing off (see CbcTailingOffReturn)
+        given time and bound after each of numberPoints recent passes.
+        If true explanation says why */
+    bool tailingOff(const double * passTime, const double * passObjective,
+                    int numberPoints, char * explanation) const;
+    /** Add point to timeline if incumbent or best possible changed (or force).
+        -COIN_DBL_MAX keeps last best possible */
+    void addTimelinePoint(double bestPossible = -COIN_DBL_MAX, bool force = false);
+    /// Best possible from tree (allowing for nodes in threads)
+    double treeBestPossible();
+    /** Select row cuts in a round by efficacy, orthogonality to cuts
+        already selected and density.  whichGenerator is kept in step.
+        Returns number of cuts dropped */
+    int selectCuts(OsiCuts & theseCuts, int * whichGenerator);
 public:
 #ifdef CBC_KEEP_DEPRECATED
     // See if anyone is using these any more!!
@@ -312,6 +364,10 @@ public:
 
         If makeEquality is 1 add slacks to get cliques,
         if 2 add slacks to get sos (but only if looks plausible) and keep sos info
+
+        If CbcPreProcessSeconds is positive or there is more than one thread
+        probing stops after that wall clock time and is threaded (see
+        CbcPreProcessProbing); reductions of each pass are reported.
     */
     CglPreProcess * preProcess( int makeEquality = 0, int numberPasses = 5,
                                 int tuning = 5);
@@ -1238,6 +1294,15 @@ public:
     */
     virtual double checkSolution(double cutoff, double * solution,
                          int fixVariables, double originalObjValue);
+    /** Quick check of solution without LP - used by checkSolution.
+        Integers are rounded and bounds and rows of continuous solver
+        checked.  Row activities are updated from last solution checked if
+        few columns differ.  Returns true if feasible (then solution is
+        cleaned and objectiveValue set), false if LP is needed.
+        Accepted solutions are not LP-polished - continuous variables
+        keep the values passed in.
+    */
+    bool quickCheckSolution(double * solution, double & objectiveValue);
     /** Test the current solution for feasiblility.
 
       Scan all objects for indications of infeasibility. This is broken down
@@ -1827,7 +1892,9 @@ public:
     inline int getRandomSeed() const {
         return randomSeed_;
     }
-    /// Set multiple root tries
+    /** Set multiple root tries.
+        See also CbcRootRacingSeconds for racing the tries
+        and handing the best one over to the main search */
     inline void setMultipleRootTries(int value) {
         multipleRootTries_ = value;
     }
@@ -1893,6 +1960,12 @@ public:
 	11/12 bit 2048 - intermittent cuts
 	13/14 bit 8192 - go to bitter end in strong branching (first time)
 	15 bit 32768 - take care of very very small values for Integer/SOS variables
+	16 bit 65536 - keep basis changes at nodes in compressed form
+	17 bit 131072 - activity based bound propagation after branching
+	18 bit 262144 - learn conflicts from infeasible nodes and prune with them
+	19 bit 524288 - adaptive cut generator frequency in tree
+	20 bit 1048576 - select cuts by efficacy, orthogonality and density
+	21 bit 2097152 - profile where time goes in branch and bound
     */
     inline void setMoreSpecialOptions2(int value) {
         moreSpecialOptions2_ = value;
@@ -1916,6 +1989,151 @@ public:
     inline bool useElapsedTime() const {
         return (moreSpecialOptions_&131072)!=0;
     }
+    /// Set whether basis changes at nodes are kept compressed
+    inline void setCompressNodeBases(bool yesNo) {
+        if (yesNo)
+  	  moreSpecialOptions2_ |= 65536;
+	else
+	  moreSpecialOptions2_ &= ~65536;
+    }
+    /// Get whether basis changes at nodes are kept compressed
+    inline bool compressNodeBases() const {
+        return (moreSpecialOptions2_&65536)!=0;
+    }
+    /// Set whether bounds are propagated after branching
+    inline void setNodePropagation(bool yesNo) {
+        if (yesNo)
+  	  moreSpecialOptions2_ |= 131072;
+	else
+	  moreSpecialOptions2_ &= ~131072;
+    }
+    /// Get whether bounds are propagated after branching
+    inline bool nodePropagation() const {
+        return (moreSpecialOptions2_&131072)!=0;
+    }
+    /// Set whether conflicts are learned and used to prune nodes
+    inline void setConflictLearning(bool yesNo) {
+        if (yesNo)
+  	  moreSpecialOptions2_ |= 262144;
+	else
+	  moreSpecialOptions2_ &= ~262144;
+    }
+    /// Get whether conflicts are learned and used to prune nodes
+    inline bool conflictLearning() const {
+        return (moreSpecialOptions2_&262144)!=0;
+    }
+    /** Set whether cut generators are throttled or boosted in tree
+        from measured objective change per second.
+        Added cuts then keep the index of their generator (rather than 90)
+        so root statistics per generator count them as well */
+    inline void setAdaptiveCutFrequency(bool yesNo) {
+        if (yesNo)
+  	  moreSpecialOptions2_ |= 524288;
+	else
+	  moreSpecialOptions2_ &= ~524288;
+    }
+    /// Get whether cut generator frequency is adaptive in tree
+    inline bool adaptiveCutFrequency() const {
+        return (moreSpecialOptions2_&524288)!=0;
+    }
+    /** Set whether row cuts from a round are selected by efficacy,
+        orthogonality and density before being added to LP */
+    inline void setCutSelection(bool yesNo) {
+        if (yesNo)
+  	  moreSpecialOptions2_ |= 1048576;
+	else
+	  moreSpecialOptions2_ &= ~1048576;
+    }
+    /// Get whether row cuts are selected before being added to LP
+    inline bool cutSelection() const {
+        return (moreSpecialOptions2_&1048576)!=0;
+    }
+    /** Set whether time in parts of branch and bound is profiled
+        (see CbcProfile) - report as JSON at end */
+    inline void setProfiling(bool yesNo) {
+        if (yesNo)
+  	  moreSpecialOptions2_ |= 2097152;
+	else
+	  moreSpecialOptions2_ &= ~2097152;
+    }
+    /// Get whether branch and bound is profiled
+    inline bool profiling() const {
+        return (moreSpecialOptions2_&2097152)!=0;
+    }
+    /// Get profile of last branch and bound (NULL if not profiled)
+    inline CbcProfile * profile() const {
+        return profile_;
+    }
+    /// Profile of last branch and bound as JSON ("" if not profiled)
+    const char * profileReport() const;
+    /** Set maximum row cuts kept in a round by cut selection.
+        0 (default) means automatic - more at root than in tree */
+    inline void setMaximumCutsPerRound(int value) {
+        maximumCutsPerRound_ = value;
+    }
+    /// Get maximum row cuts kept in a round by cut selection
+    inline int maximumCutsPerRound() const {
+        return maximumCutsPerRound_;
+    }
+    /** Set cut aging in root cut loop.  If passes > 0 a slack cut is only
+        taken off after being slack for that many consecutive passes and
+        rows are only deleted when at least batch cuts are that old
+        (0 means automatic - 5% of rows).  Cuts taken off are held and
+        added back every pass if violated.  0 (default) takes off slack
+        cuts each pass */
+    inline void setCutAging(int passes, int batch = 0) {
+        cutAgeLimit_ = passes;
+        cutDeletionBatch_ = batch;
+    }
+    /// Get number of slack passes before a cut is taken off (0 off)
+    inline int cutAgeLimit() const {
+        return cutAgeLimit_;
+    }
+    /// Get minimum number of old cuts in a batched deletion (0 automatic)
+    inline int cutDeletionBatch() const {
+        return cutDeletionBatch_;
+    }
+    /// Record memory used by a compressed node basis (and what it would have been)
+    inline void addCompressedNodeBasis(int compressedBytes, int uncompressedBytes) {
+        numberCompressedBases_++;
+        compressedBasisBytes_ += compressedBytes;
+        uncompressedBasisBytes_ += uncompressedBytes;
+    }
+    /** Record a leaf of the search tree (node pruned, infeasible or
+        integer) at given depth.  Used by the weighted backtrack
+        estimate of tree size. */
+    void recordTreeLeaf(int depth);
+    /** Estimated total number of nodes in search tree.
+        -1.0 if no estimate yet - updated at each tree status interval
+        and set to number of nodes when search completes */
+    inline double getEstimatedTreeNodes() const {
+        return estimatedTreeNodes_;
+    }
+    /** Estimated seconds until search completes.
+        -1.0 if no estimate yet - updated at each tree status interval
+        and set to 0.0 when search completes */
+    inline double getEstimatedSecondsLeft() const {
+        return estimatedSecondsLeft_;
+    }
+    /** Number of points in incumbent and best possible timeline of last
+        branch and bound (one each time either changed) */
+    inline int numberTimelinePoints() const {
+        return numberTimelinePoints_;
+    }
+    /** Timeline as time (as getCurrentSeconds), incumbent and best
+        possible triples - minimization sense, 1.0e50 if no solution */
+    inline const double * timeline() const {
+        return timeline_;
+    }
+    /** Primal integral of last branch and bound - integral over time of
+        gap between incumbent and reference (1 with no incumbent).
+        Gap is |a-b|/max(|a|,|b|) or 1 if signs differ.  Reference is in
+        minimization sense and defaults to best solution found */
+    double primalIntegral(double reference = COIN_DBL_MAX) const;
+    /// Dual integral - as primalIntegral but for best possible
+    double dualIntegral(double reference = COIN_DBL_MAX) const;
+    /// Primal-dual integral - integral of gap between incumbent and best possible
+    double primalDualIntegral() const;
     /// Get useful temporary pointer
     inline void * temporaryPointer() const
     { return temporaryPointer_;}
@@ -2080,6 +2298,8 @@ public:
         4 set then use numberThreads in root mini branch and bound
         8 set and numberThreads - do heuristics numberThreads at a time
         8 set and numberThreads==0 do all heuristics at once
+        16 set then use numberThreads in mini trees (CbcGeneralDepth)
+           and search tree serially
         default is 0
     */
     inline void setThreadMode(int value) {
@@ -2164,6 +2384,12 @@ public:
       penalties.  Returns number fixed
     */
     int reducedCostFix() ;
+    /** Perform reduced cost fixing globally using reduced costs saved
+        after root LP and given cutoff.  Called when incumbent improves.
+        Bounds are tightened in root node so all later nodes see them.
+        Returns number of bounds changed
+    */
+    int rootReducedCostFix(double cutoff) ;
     /** Makes all handlers same.  If makeDefault 1 then makes top level
         default and rest point to that.  If 2 then each is copy
     */
@@ -2287,6 +2513,8 @@ public:
     void doHeuristicsAtRoot(int deleteHeuristicsAfterwards = 0);
     /// Adjust heuristics based on model
     void adjustHeuristics();
+    /// Update tree size and time to completion estimates
+    void updateTreeEstimate();
     /// Get the hotstart solution
     inline const double * hotstartSolution() const {
         return hotstartSolution_;
@@ -2322,6 +2550,34 @@ public:
     inline CglTreeProbingInfo * probingInfo() const {
         return probingInfo_;
     }
+    /// Get a pointer to node bound propagation (NULL if not active)
+    inline CbcPropagation * propagation() const {
+        return propagation_;
+    }
+    /// Get a pointer to learned conflicts (NULL if not active)
+    inline CbcConflictStore * conflictStore() const {
+        return conflicts_;
+    }
+    /** Set on disk cache (not owned - copies of model share it).
+        Root basis and pseudo costs are reused for models of the same
+        structure and saved afterwards */
+    inline void setModelCache(CbcModelCache * cache) {
+        modelCache_ = cache;
+    }
+    /// Get a pointer to on disk cache (NULL if none)
+    inline CbcModelCache * modelCache() const {
+        return modelCache_;
+    }
+    /** Set node trace (not owned - copies of model share it).
+        thread is which ring events go in (0 main, i+1 for thread i) */
+    inline void setNodeTrace(CbcNodeTrace * trace, int thread = 0) {
+        nodeTrace_ = trace;
+        nodeTraceThread_ = thread;
+    }
+    /// Get a pointer to node trace (NULL if none)
+    inline CbcNodeTrace * nodeTrace() const {
+        return nodeTrace_;
+    }
     /// Thread specific random number generator
     inline CoinThreadRandom * randomNumberGenerator() {
         return &randomNumberGenerator_;
@@ -2402,6 +2658,8 @@ public:
     }
     /// Create C++ lines to get to current state
     void generateCpp( FILE * fp, int options);
+    /// Create C++ lines (and comments with statistics) to tune cut generators
+    void generateTuning( FILE * fp);
     /// Generate an OsiBranchingInformation object
     OsiBranchingInformation usefulInformation() const;
     /** Warm start object produced by heuristic or strong branching
@@ -2867,8 +3125,111 @@ private:
     int maximumDepthActual_;
     /// Number of reduced cost fixings
     double numberDJFixed_;
+    /// Time spent in reduced cost fixing
+    double timeInReducedCostFix_;
+    /// Number of bounds changed by fixing from root reduced costs
+    int numberRootDJFixed_;
+    /// Number of new solutions root reduced costs were used for
+    int numberRootDJPasses_;
+    /// Bounds changed by reducedCostFix before any node was done
+    int numberRootReducedCostFixes_;
+    /// Objective of root LP when rootReducedCost_ was saved
+    double rootObjectiveValue_;
+    /** Root reduced costs (times direction, zero if not usable) for each
+        integer then bounds they were at */
+    double * rootReducedCost_;
+    /// Work array for reducedCostFix candidates (size sizeReducedCostMark_)
+    char * reducedCostMark_;
+    /// Size of reducedCostMark_
+    int sizeReducedCostMark_;
+    /// Row activities of checkReference_ (quickCheckSolution)
+    double * checkActivity_;
+    /// Last solution looked at by quickCheckSolution
+    double * checkReference_;
+    /// Number of rows when checkActivity_ made
+    int checkNumberRows_;
+    /// Number of columns when checkReference_ made
+    int checkNumberColumns_;
+    /// Incremental updates to checkActivity_ since computed from scratch
+    int checkUpdates_;
+    /// Number of solutions checked by checkSolution
+    int numberSolutionChecks_;
+    /// Number of solutions accepted without LP
+    int numberQuickChecks_;
+    /// Number of nodes with compressed basis changes
+    int numberCompressedBases_;
+    /// Bytes used by compressed node bases
+    double compressedBasisBytes_;
+    /// Bytes uncompressed node bases would have used
+    double uncompressedBasisBytes_;
+    /// Maximum row cuts kept in a round by cut selection (0 automatic)
+    int maximumCutsPerRound_;
+    /// Row cuts offered to cut selection
+    int numberCutCandidates_;
+    /// Row cuts kept by cut selection
+    int numberCutsSelected_;
+    /// Time in cut selection
+    double timeInCutSelection_;
+    /// Number of resolves after adding cuts
+    int numberCutResolves_;
+    /// Sum of rows in LP at resolves after adding cuts
+    double cutResolveRows_;
+    /// Time in resolves after adding cuts
+    double timeInCutResolves_;
+    /// Passes a cut must be slack before being taken off (0 off)
+    int cutAgeLimit_;
+    /// Minimum number of old cuts in a batched deletion (0 automatic)
+    int cutDeletionBatch_;
+    /// Number of consecutive slack passes for each cut row (root only)
+    int * cutAge_;
+    /// Number of cut rows in cutAge_
+    int numberCutAges_;
+    /// Space in cutAge_
+    int maximumCutAges_;
+    /// Cuts deleted after aging
+    int numberAgedCutsDeleted_;
+    /// Batched deletions of aged cuts
+    int numberCutDeletionBatches_;
+    /// Held cuts added back as violated
+    int numberHeldCutsAdded_;
+    /// Incumbent and best possible timeline (NULL unless main model in search)
+    double * timeline_;
+    /// Points in timeline_
+    int numberTimelinePoints_;
+    /// Space in timeline_ (points)
+    int maximumTimelinePoints_;
+    /// Time best possible was last taken from tree for timeline
+    double lastTimelineSample_;
+    /// Sum of weights 2**-depth of leaves seen (tree size estimate)
+    double treeLeafWeight_;
+    /// Sum of weighted leaf estimates 2-2**-depth (tree size estimate)
+    double treeLeafSum_;
+    /// Estimated total number of nodes (-1.0 if not known)
+    double estimatedTreeNodes_;
+    /// Estimated seconds to completion (-1.0 if not known)
+    double estimatedSecondsLeft_;
+    /// Time when gap first became finite (-1.0 if not yet)
+    double gapStartTime_;
+    /// Relative gap at gapStartTime_
+    double gapStart_;
+    /// Time of first tree estimate (-1.0 if not yet)
+    double treeStartSeconds_;
+    /// Nodes done at first tree estimate
+    int treeStartNodes_;
     /// Probing info
     CglTreeProbingInfo * probingInfo_;
+    /// Bound propagation after branching
+    CbcPropagation * propagation_;
+    /// Learned conflicts
+    CbcConflictStore * conflicts_;
+    /// On disk cache (not owned)
+    CbcModelCache * modelCache_;
+    /// Node trace (not owned)
+    CbcNodeTrace * nodeTrace_;
+    /// Ring in node trace for this model
+    int nodeTraceThread_;
+    /// Profile (NULL unless profiling)
+    CbcProfile * profile_;
     /// Number of fixed by analyze at root
     int numberFixedAtRoot_;
     /// Number fixed by analyze so far
@@ -2936,6 +3297,7 @@ private:
         1 set then deterministic
         2 set then use numberThreads for root cuts
         4 set then use numberThreads in root mini branch and bound
+        16 set then use numberThreads in mini trees (CbcGeneralDepth)
         default is 0
     */
     int threadMode_;
@@ -0,0 +1,569 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <cassert>
+#include <cmath>
+#include <cfloat>
+#include <cstdio>
+#include <cstring>
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinWarmStartBasis.hpp"
+#include "OsiSolverInterface.hpp"
+#include "OsiRowCut.hpp"
+#include "CbcModel.hpp"
+#include "CbcSimpleIntegerDynamicPseudoCost.hpp"
+#include "CbcModelCache.hpp"
+
+// Identifies a cache file - change version if layout changes
+#define CBC_CACHE_MAGIC 0x43626343
+#define CBC_CACHE_VERSION 1
+
+namespace {
+// 64 bit FNV-1a step
+inline CoinUInt64 hashInto(CoinUInt64 hash, CoinUInt64 value)
+{
+    for (int i = 0; i < 8; i++) {
+        hash ^= (value & 0xff);
+        hash *= 1099511628211ULL;
+        value >>= 8;
+    }
+    return hash;
+}
+// Bits of double
+inline CoinUInt64 doubleBits(double value)
+{
+    CoinUInt64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+// Append bytes to buffer
+inline void putBytes(std::vector<char> & buffer, const void * from, size_t size)
+{
+    const char * bytes = reinterpret_cast<const char *> (from);
+    buffer.insert(buffer.end(), bytes, bytes + size);
+}
+// Take bytes from buffer - false if not enough
+inline bool takeBytes(const std::vector<char> & buffer, size_t & offset,
+                      void * to, size_t size)
+{
+    if (offset + size > buffer.size())
+        return false;
+    memcpy(to, &buffer[0] + offset, size);
+    offset += size;
+    return true;
+}
+}
+
+// Default Constructor
+CbcModelCache::CbcModelCache ()
+        : rootFingerprint_(0),
+        rootCutoff_(COIN_DBL_MAX),
+        modelFingerprint_(0),
+        modelNumberRows_(0),
+        modelNumberColumns_(0),
+        numberHits_(0),
+        numberMisses_(0)
+{
+    resetReused();
+}
+
+// Constructor with directory
+CbcModelCache::CbcModelCache (const char * directory)
+        : directory_(directory ? directory : ""),
+        rootFingerprint_(0),
+        rootCutoff_(COIN_DBL_MAX),
+        modelFingerprint_(0),
+        modelNumberRows_(0),
+        modelNumberColumns_(0),
+        numberHits_(0),
+        numberMisses_(0)
+{
+    resetReused();
+}
+
+// Copy constructor
+CbcModelCache::CbcModelCache ( const CbcModelCache & rhs)
+        : directory_(rhs.directory_),
+        memory_(rhs.memory_),
+        status_(rhs.status_),
+        pseudoColumn_(rhs.pseudoColumn_),
+        pseudoCost_(rhs.pseudoCost_),
+        pseudoNumber_(rhs.pseudoNumber_),
+        rootCuts_(rhs.rootCuts_),
+        rootFingerprint_(rhs.rootFingerprint_),
+        rootLower_(rhs.rootLower_),
+        rootUpper_(rhs.rootUpper_),
+        rootObjective_(rhs.rootObjective_),
+        rootCutoff_(rhs.rootCutoff_),
+        modelFingerprint_(rhs.modelFingerprint_),
+        modelNumberRows_(rhs.modelNumberRows_),
+        modelNumberColumns_(rhs.modelNumberColumns_),
+        numberHits_(rhs.numberHits_),
+        numberMisses_(rhs.numberMisses_)
+{
+    memcpy(reused_, rhs.reused_, sizeof(reused_));
+}
+
+// Assignment operator
+CbcModelCache &
+CbcModelCache::operator=( const CbcModelCache & rhs)
+{
+    if (this != &rhs) {
+        directory_ = rhs.directory_;
+        memory_ = rhs.memory_;
+        status_ = rhs.status_;
+        pseudoColumn_ = rhs.pseudoColumn_;
+        pseudoCost_ = rhs.pseudoCost_;
+        pseudoNumber_ = rhs.pseudoNumber_;
+        rootCuts_ = rhs.rootCuts_;
+        rootFingerprint_ = rhs.rootFingerprint_;
+        rootLower_ = rhs.rootLower_;
+        rootUpper_ = rhs.rootUpper_;
+        rootObjective_ = rhs.rootObjective_;
+        rootCutoff_ = rhs.rootCutoff_;
+        modelFingerprint_ = rhs.modelFingerprint_;
+        modelNumberRows_ = rhs.modelNumberRows_;
+        modelNumberColumns_ = rhs.modelNumberColumns_;
+        numberHits_ = rhs.numberHits_;
+        numberMisses_ = rhs.numberMisses_;
+        memcpy(reused_, rhs.reused_, sizeof(reused_));
+    }
+    return *this;
+}
+
+// Destructor
+CbcModelCache::~CbcModelCache ()
+{
+}
+
+// Set directory
+void
+CbcModelCache::setDirectory(const char * directory)
+{
+    directory_ = directory ? directory : "";
+}
+
+// Clear what was reused
+void
+CbcModelCache::resetReused()
+{
+    memset(reused_, 0, sizeof(reused_));
+}
+
+/*
+  Hash of dimensions, matrix and integrality.  Elements within a column are
+  combined so that their order does not matter.
+*/
+CoinUInt64
+CbcModelCache::fingerprint(const OsiSolverInterface * solver)
+{
+    int numberRows = solver->getNumRows();
+    int numberColumns = solver->getNumCols();
+    CoinUInt64 hash = 14695981039346656037ULL;
+    hash = hashInto(hash, static_cast<CoinUInt64> (numberRows));
+    hash = hashInto(hash, static_cast<CoinUInt64> (numberColumns));
+    const CoinPackedMatrix * matrix = solver->getMatrixByCol();
+    const CoinBigIndex * columnStart = matrix->getVectorStarts();
+    const int * columnLength = matrix->getVectorLengths();
+    const int * row = matrix->getIndices();
+    const double * element = matrix->getElements();
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+        CoinUInt64 sum = 0;
+        for (CoinBigIndex j = columnStart[iColumn];
+                j < columnStart[iColumn] + columnLength[iColumn]; j++) {
+            CoinUInt64 one = hashInto(14695981039346656037ULL,
+                                      static_cast<CoinUInt64> (row[j]));
+            sum += hashInto(one, doubleBits(element[j]));
+        }
+        hash = hashInto(hash, sum);
+        hash = hashInto(hash, static_cast<CoinUInt64> (columnLength[iColumn]));
+        hash = hashInto(hash, solver->isInteger(iColumn) ? 1 : 0);
+    }
+    return hash;
+}
+
+// Note structure of model
+void
+CbcModelCache::setStructure(const OsiSolverInterface * solver)
+{
+    modelFingerprint_ = fingerprint(solver);
+    modelNumberRows_ = solver->getNumRows();
+    modelNumberColumns_ = solver->getNumCols();
+}
+
+// File name for fingerprint
+std::string
+CbcModelCache::fileName(CoinUInt64 fingerprint) const
+{
+    char name[40];
+    sprintf(name, "cbc%08x%08x.cache",
+            static_cast<unsigned int> (fingerprint >> 32),
+            static_cast<unsigned int> (fingerprint & 0xffffffff));
+    std::string fullName = directory_;
+    if (fullName[fullName.size()-1] != '/')
+        fullName += '/';
+    return fullName + name;
+}
+
+// Get entry
+bool
+CbcModelCache::read(CoinUInt64 fingerprint, int numberRows, int numberColumns)
+{
+    status_.clear();
+    pseudoColumn_.clear();
+    pseudoCost_.clear();
+    pseudoNumber_.clear();
+    std::vector<char> buffer;
+    if (directory_.empty()) {
+        std::map<CoinUInt64, std::vector<char> >::const_iterator it =
+            memory_.find(fingerprint);
+        if (it == memory_.end())
+            return false;
+        buffer = it->second;
+    } else {
+        std::string name = fileName(fingerprint);
+        FILE * fp = fopen(name.c_str(), "rb");
+        if (!fp)
+            return false;
+        char chunk[4096];
+        size_t nRead;
+        while ((nRead = fread(chunk, 1, sizeof(chunk), fp)) > 0)
+            buffer.insert(buffer.end(), chunk, chunk + nRead);
+        fclose(fp);
+    }
+    size_t offset = 0;
+    int header[4];
+    CoinUInt64 entryFingerprint = 0;
+    bool good = takeBytes(buffer, offset, header, 4 * sizeof(int)) &&
+                takeBytes(buffer, offset, &entryFingerprint, sizeof(CoinUInt64));
+    if (good && (header[0] != CBC_CACHE_MAGIC || header[1] != CBC_CACHE_VERSION ||
+                 header[2] != numberRows || header[3] != numberColumns ||
+                 entryFingerprint != fingerprint))
+        good = false;
+    int numberStatus = 0;
+    if (good && (!takeBytes(buffer, offset, &numberStatus, sizeof(int)) ||
+                 (numberStatus && numberStatus != numberRows + numberColumns)))
+        good = false;
+    if (good && numberStatus) {
+        status_.resize(numberStatus);
+        good = takeBytes(buffer, offset, &status_[0], numberStatus);
+    }
+    int numberPseudo = 0;
+    if (good && (!takeBytes(buffer, offset, &numberPseudo, sizeof(int)) ||
+                 numberPseudo < 0 || numberPseudo > numberColumns))
+        good = false;
+    if (good && numberPseudo) {
+        pseudoColumn_.resize(numberPseudo);
+        pseudoCost_.resize(2 * numberPseudo);
+        pseudoNumber_.resize(2 * numberPseudo);
+        good = takeBytes(buffer, offset, &pseudoColumn_[0], numberPseudo * sizeof(int)) &&
+               takeBytes(buffer, offset, &pseudoCost_[0], 2 * numberPseudo * sizeof(double)) &&
+               takeBytes(buffer, offset, &pseudoNumber_[0], 2 * numberPseudo * sizeof(int));
+        for (int i = 0; i < numberPseudo && good; i++) {
+            if (pseudoColumn_[i] < 0 || pseudoColumn_[i] >= numberColumns)
+                good = false;
+        }
+    }
+    if (!good) {
+        status_.clear();
+        pseudoColumn_.clear();
+        pseudoCost_.clear();
+        pseudoNumber_.clear();
+    }
+    return good;
+}
+
+// Put entry
+bool
+CbcModelCache::write(CoinUInt64 fingerprint, int numberRows, int numberColumns)
+{
+    std::vector<char> buffer;
+    int header[4];
+    header[0] = CBC_CACHE_MAGIC;
+    header[1] = CBC_CACHE_VERSION;
+    header[2] = numberRows;
+    header[3] = numberColumns;
+    putBytes(buffer, header, 4 * sizeof(int));
+    putBytes(buffer, &fingerprint, sizeof(CoinUInt64));
+    int numberStatus = static_cast<int> (status_.size());
+    putBytes(buffer, &numberStatus, sizeof(int));
+    if (numberStatus)
+        putBytes(buffer, &status_[0], numberStatus);
+    int numberPseudo = static_cast<int> (pseudoColumn_.size());
+    putBytes(buffer, &numberPseudo, sizeof(int));
+    if (numberPseudo) {
+        putBytes(buffer, &pseudoColumn_[0], numberPseudo * sizeof(int));
+        putBytes(buffer, &pseudoCost_[0], 2 * numberPseudo * sizeof(double));
+        putBytes(buffer, &pseudoNumber_[0], 2 * numberPseudo * sizeof(int));
+    }
+    if (directory_.empty()) {
+        memory_[fingerprint].swap(buffer);
+        return true;
+    }
+    std::string name = fileName(fingerprint);
+    char suffix[20];
+    sprintf(suffix, ".%p", static_cast<void *> (this));
+    std::string tempName = name + suffix;
+    FILE * fp = fopen(tempName.c_str(), "wb");
+    if (!fp)
+        return false;
+    bool good = fwrite(&buffer[0], 1, buffer.size(), fp) == buffer.size();
+    if (fclose(fp))
+        good = false;
+    if (good)
+        good = rename(tempName.c_str(), name.c_str()) == 0;
+    if (!good)
+        remove(tempName.c_str());
+    return good;
+}
+
+// Set warm start from cache
+bool
+CbcModelCache::restoreBasis(OsiSolverInterface * solver)
+{
+    int numberRows = solver->getNumRows();
+    int numberColumns = solver->getNumCols();
+    if (!read(fingerprint(solver), numberRows, numberColumns) || status_.empty()) {
+        numberMisses_++;
+        return false;
+    }
+    const double * lower = solver->getColLower();
+    const double * upper = solver->getColUpper();
+    const double * rowLower = solver->getRowLower();
+    const double * rowUpper = solver->getRowUpper();
+    CoinWarmStartBasis basis;
+    basis.setSize(numberColumns, numberRows);
+    int numberBasic = 0;
+    for (int i = 0; i < numberColumns + numberRows; i++) {
+        CoinWarmStartBasis::Status status =
+            static_cast<CoinWarmStartBasis::Status> (status_[i]);
+        double lo, up;
+        if (i < numberColumns) {
+            lo = lower[i];
+            up = upper[i];
+        } else {
+            // artificial at lower bound means row at upper bound
+            int iRow = i - numberColumns;
+            lo = -rowUpper[iRow];
+            up = -rowLower[iRow];
+        }
+        // bounds may have changed - move off infinite bounds
+        if (status == CoinWarmStartBasis::basic) {
+            numberBasic++;
+        } else if (status == CoinWarmStartBasis::atUpperBound && up >= 1.0e30) {
+            status = (lo > -1.0e30) ? CoinWarmStartBasis::atLowerBound :
+                     CoinWarmStartBasis::isFree;
+        } else if (status == CoinWarmStartBasis::atLowerBound && lo <= -1.0e30) {
+            status = (up < 1.0e30) ? CoinWarmStartBasis::atUpperBound :
+                     CoinWarmStartBasis::isFree;
+        } else if (status == CoinWarmStartBasis::isFree &&
+                   (lo > -1.0e30 || up < 1.0e30)) {
+            status = (lo > -1.0e30) ? CoinWarmStartBasis::atLowerBound :
+                     CoinWarmStartBasis::atUpperBound;
+        }
+        if (i < numberColumns)
+            basis.setStructStatus(i, status);
+        else
+            basis.setArtifStatus(i - numberColumns, status);
+    }
+    if (numberBasic != numberRows) {
+        numberMisses_++;
+        return false;
+    }
+    numberHits_++;
+    if (!solver->setWarmStart(&basis))
+        return false;
+    reused_[0] = 1;
+    return true;
+}
+
+// Save basis
+bool
+CbcModelCache::saveBasis(const OsiSolverInterface * solver)
+{
+    CoinWarmStart * warmStart = solver->getWarmStart();
+    CoinWarmStartBasis * basis = dynamic_cast<CoinWarmStartBasis *> (warmStart);
+    int numberRows = solver->getNumRows();
+    int numberColumns = solver->getNumCols();
+    bool good = false;
+    if (basis && basis->getNumStructural() == numberColumns &&
+            basis->getNumArtificial() == numberRows) {
+        CoinUInt64 fingerprintNow = fingerprint(solver);
+        // keep any pseudo costs
+        read(fingerprintNow, numberRows, numberColumns);
+        status_.resize(numberColumns + numberRows);
+        for (int i = 0; i < numberColumns; i++)
+            status_[i] = static_cast<char> (basis->getStructStatus(i));
+        for (int i = 0; i < numberRows; i++)
+            status_[numberColumns+i] = static_cast<char> (basis->getArtifStatus(i));
+        good = write(fingerprintNow, numberRows, numberColumns);
+    }
+    delete warmStart;
+    return good;
+}
+
+// Set pseudo costs from cache
+int
+CbcModelCache::restorePseudoCosts(CbcModel * model)
+{
+    setStructure(model->solver());
+    if (!read(modelFingerprint_, modelNumberRows_, modelNumberColumns_) ||
+            pseudoColumn_.empty()) {
+        numberMisses_++;
+        return 0;
+    }
+    int numberPseudo = static_cast<int> (pseudoColumn_.size());
+    int * which = new int [modelNumberColumns_];
+    CoinFillN(which, modelNumberColumns_, -1);
+    for (int i = 0; i < numberPseudo; i++)
+        which[pseudoColumn_[i]] = i;
+    // counts are capped so strong branching is not switched off for good
+    int numberBeforeTrust = model->numberBeforeTrust();
+    int numberSet = 0;
+    int numberObjects = model->numberObjects();
+    OsiObject ** objects = model->objects();
+    for (int i = 0; i < numberObjects; i++) {
+        CbcSimpleIntegerDynamicPseudoCost * obj =
+            dynamic_cast <CbcSimpleIntegerDynamicPseudoCost *>(objects[i]) ;
+        if (!obj)
+            continue;
+        int k = which[obj->columnNumber()];
+        if (k < 0)
+            continue;
+        obj->setNumberTimesDown(CoinMin(pseudoNumber_[2*k], numberBeforeTrust));
+        obj->setNumberTimesUp(CoinMin(pseudoNumber_[2*k+1], numberBeforeTrust));
+        obj->setDownDynamicPseudoCost(pseudoCost_[2*k]);
+        obj->setUpDynamicPseudoCost(pseudoCost_[2*k+1]);
+        numberSet++;
+    }
+    delete [] which;
+    numberHits_++;
+    reused_[1] = numberSet;
+    return numberSet;
+}
+
+// Save pseudo costs
+bool
+CbcModelCache::savePseudoCosts(const CbcModel * model)
+{
+    if (!modelNumberColumns_)
+        setStructure(model->solver());
+    // keep any basis
+    read(modelFingerprint_, modelNumberRows_, modelNumberColumns_);
+    pseudoColumn_.clear();
+    pseudoCost_.clear();
+    pseudoNumber_.clear();
+    int numberObjects = model->numberObjects();
+    OsiObject ** objects = model->objects();
+    for (int i = 0; i < numberObjects; i++) {
+        const CbcSimpleIntegerDynamicPseudoCost * obj =
+            dynamic_cast <const CbcSimpleIntegerDynamicPseudoCost *>(objects[i]) ;
+        if (!obj || obj->columnNumber() >= modelNumberColumns_ ||
+                !obj->numberTimesBranched())
+            continue;
+        pseudoColumn_.push_back(obj->columnNumber());
+        pseudoCost_.push_back(obj->downDynamicPseudoCost());
+        pseudoCost_.push_back(obj->upDynamicPseudoCost());
+        pseudoNumber_.push_back(obj->numberTimesDown());
+        pseudoNumber_.push_back(obj->numberTimesUp());
+    }
+    if (pseudoColumn_.empty())
+        return false;
+    return write(modelFingerprint_, modelNumberRows_, modelNumberColumns_);
+}
+
+// Add saved root cuts as global cuts
+int
+CbcModelCache::restoreRootCuts(CbcModel * model)
+{
+    const OsiSolverInterface * solver = model->solver();
+    setStructure(solver);
+    int numberCuts = rootCuts_.sizeRowCuts();
+    if (!numberCuts || rootFingerprint_ != modelFingerprint_)
+        return 0;
+    // cuts are only valid inside region they were generated for
+    const double * lower = solver->getColLower();
+    const double * upper = solver->getColUpper();
+    for (int i = 0; i < modelNumberColumns_; i++) {
+        if (lower[i] < rootLower_[i] - 1.0e-9 || upper[i] > rootUpper_[i] + 1.0e-9)
+            return 0;
+    }
+    lower = solver->getRowLower();
+    upper = solver->getRowUpper();
+    for (int i = 0; i < modelNumberRows_; i++) {
+        int k = modelNumberColumns_ + i;
+        if (lower[i] < rootLower_[k] - 1.0e-9 || upper[i] > rootUpper_[k] + 1.0e-9)
+            return 0;
+    }
+    if (rootCutoff_ < 1.0e40) {
+        // cuts may depend on objective being below cutoff
+        double cutoff = model->getCutoff();
+        if (cutoff > rootCutoff_ + 1.0e-7 * (1.0 + fabs(rootCutoff_)))
+            return 0;
+        const double * objective = solver->getObjCoefficients();
+        double direction = solver->getObjSense();
+        for (int i = 0; i < modelNumberColumns_; i++) {
+            if (objective[i] * direction != rootObjective_[i])
+                return 0;
+        }
+    }
+    for (int i = 0; i < numberCuts; i++)
+        model->makeGlobalCut(rootCuts_.rowCut(i));
+    reused_[2] = numberCuts;
+    return numberCuts;
+}
+
+// Save cuts in solver as root cuts
+int
+CbcModelCache::saveRootCuts(const CbcModel * model)
+{
+    const OsiSolverInterface * solver = model->solver();
+    int numberRows = model->numberRowsAtContinuous();
+    int numberColumns = solver->getNumCols();
+    if (!modelNumberColumns_ || numberRows != modelNumberRows_ ||
+            numberColumns != modelNumberColumns_)
+        return 0;
+    rootCuts_ = OsiCuts();
+    rootFingerprint_ = modelFingerprint_;
+    const double * lower = solver->getColLower();
+    const double * upper = solver->getColUpper();
+    rootLower_.assign(lower, lower + numberColumns);
+    rootUpper_.assign(upper, upper + numberColumns);
+    lower = solver->getRowLower();
+    upper = solver->getRowUpper();
+    rootLower_.insert(rootLower_.end(), lower, lower + numberRows);
+    rootUpper_.insert(rootUpper_.end(), upper, upper + numberRows);
+    rootCutoff_ = model->getCutoff();
+    const double * objective = solver->getObjCoefficients();
+    double direction = solver->getObjSense();
+    rootObjective_.resize(numberColumns);
+    for (int i = 0; i < numberColumns; i++)
+        rootObjective_[i] = objective[i] * direction;
+    const CoinPackedMatrix * rowCopy = solver->getMatrixByRow();
+    const CoinBigIndex * rowStart = rowCopy->getVectorStarts();
+    const int * rowLength = rowCopy->getVectorLengths();
+    const int * column = rowCopy->getIndices();
+    const double * element = rowCopy->getElements();
+    int numberCuts = solver->getNumRows() - numberRows;
+    for (int iRow = numberRows; iRow < numberRows + numberCuts; iRow++) {
+        CoinBigIndex start = rowStart[iRow];
+        OsiRowCut cut;
+        cut.setRow(rowLength[iRow], column + start, element + start, false);
+        cut.setLb(lower[iRow]);
+        cut.setUb(upper[iRow]);
+        cut.setGloballyValid(true);
+        rootCuts_.insert(cut);
+    }
+    return numberCuts;
+}
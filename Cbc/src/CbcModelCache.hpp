@@ -0,0 +1,170 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CbcModelCache_H
+#define CbcModelCache_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include "CoinPragma.hpp"
+#include "CoinTypes.hpp"
+#include "OsiCuts.hpp"
+
+class OsiSolverInterface;
+class CbcModel;
+
+/** Cache of information about models with the same structure.
+
+    Models which are solved again and again with changed bounds, right hand
+    sides or objective have the same matrix and integer variables.  A
+    fingerprint (hash of dimensions, matrix and integrality - but not bounds
+    or objective) is used as the key.  For each key there is
+
+    - an optimal basis of the continuous relaxation, used to warm start
+      CbcModel::initialSolve (statuses at infinite bounds are moved to
+      a finite bound or made free)
+    - dynamic pseudo costs from the last branch and bound on a model with
+      the same structure (after preprocessing), used instead of starting
+      from nothing
+
+    Neither can make a solve wrong - a bad basis just costs iterations.
+
+    With a directory each key is a file there; entries which do not match
+    exactly (version, fingerprint, dimensions) are ignored and files are
+    written to a temporary name and renamed so other processes never see
+    half a file.  With no directory entries are just kept in memory.
+
+    In memory the root cuts of the last branch and bound are also kept, if
+    no reduced cost fixing was done while they were generated.  They are
+    given back as global cuts only if the model has the same structure and
+    its bounds are at least as tight as then.  If there was a cutoff when
+    they were generated (probing may use it) the objective must also be the
+    same and the cutoff no larger.
+
+    From the cbc command line "-modelcache <directory>" (or memory or off)
+    attaches a cache to the model.
+*/
+
+class CbcModelCache {
+
+public:
+
+    // Default Constructor (in memory)
+    CbcModelCache ();
+
+    /// Constructor with directory for files (NULL or "" for in memory)
+    CbcModelCache (const char * directory);
+
+    // Copy constructor
+    CbcModelCache ( const CbcModelCache &);
+
+    // Assignment operator
+    CbcModelCache & operator=( const CbcModelCache& rhs);
+
+    // Destructor
+    ~CbcModelCache ();
+
+    /// Fingerprint of structure (dimensions, matrix, integrality)
+    static CoinUInt64 fingerprint(const OsiSolverInterface * solver);
+
+    /** Set warm start in solver from cache.
+        Returns true if a valid basis was found */
+    bool restoreBasis(OsiSolverInterface * solver);
+    /** Save basis in solver (should be optimal).
+        Returns true if saved */
+    bool saveBasis(const OsiSolverInterface * solver);
+    /** Set dynamic pseudo costs in model from cache - objects must exist.
+        Also notes structure of model for saves at end of search.
+        Returns number of integer variables set */
+    int restorePseudoCosts(CbcModel * model);
+    /** Save dynamic pseudo costs in model.  Uses structure of model
+        at restorePseudoCosts if that was called.  Returns true if saved */
+    bool savePseudoCosts(const CbcModel * model);
+    /** Add saved root cuts to global cuts of model if still valid.
+        Also notes structure of model.  Returns number of cuts added */
+    int restoreRootCuts(CbcModel * model);
+    /** Save cuts in solver of model (rows after continuous) as root cuts.
+        Call after restoreRootCuts.  Caller must make sure there has been
+        no reduced cost fixing at root.  Returns number of cuts saved */
+    int saveRootCuts(const CbcModel * model);
+
+    /// Set directory (NULL or "" for in memory)
+    void setDirectory(const char * directory);
+    /// Directory ("" if in memory)
+    inline const char * directory() const {
+        return directory_.c_str();
+    }
+    /// Number of times something was found in cache
+    inline int numberHits() const {
+        return numberHits_;
+    }
+    /// Number of times nothing usable was found in cache
+    inline int numberMisses() const {
+        return numberMisses_;
+    }
+    /** What was reused since resetReused.
+        0 - basis (0 or 1), 1 - number of pseudo costs, 2 - number of root
+        cuts, 3 - set by caller (e.g. 1 incumbent kept, 2 repaired) */
+    inline int reused(int which) const {
+        return reused_[which];
+    }
+    /// Set what was reused
+    inline void setReused(int which, int value) {
+        reused_[which] = value;
+    }
+    /// Clear what was reused
+    void resetReused();
+
+private:
+    /// File name for fingerprint
+    std::string fileName(CoinUInt64 fingerprint) const;
+    /// Note structure of model for pseudo costs and root cuts
+    void setStructure(const OsiSolverInterface * solver);
+    /** Get entry for fingerprint into basis and pseudo cost arrays.
+        Returns false (and arrays empty) if no valid entry */
+    bool read(CoinUInt64 fingerprint, int numberRows, int numberColumns);
+    /// Put basis and pseudo cost arrays as entry - returns true if done
+    bool write(CoinUInt64 fingerprint, int numberRows, int numberColumns);
+
+    /// Directory for files ("" in memory)
+    std::string directory_;
+    /// Entries kept in memory (same layout as files)
+    std::map<CoinUInt64, std::vector<char> > memory_;
+    /// Status of columns then rows (empty if none)
+    std::vector<char> status_;
+    /// Column of each pseudo cost
+    std::vector<int> pseudoColumn_;
+    /// Down and up pseudo costs
+    std::vector<double> pseudoCost_;
+    /// Number of times down and up
+    std::vector<int> pseudoNumber_;
+    /// Root cuts
+    OsiCuts rootCuts_;
+    /// Fingerprint of model root cuts are for
+    CoinUInt64 rootFingerprint_;
+    /// Column lower bounds then row lower bounds when root cuts saved
+    std::vector<double> rootLower_;
+    /// Column upper bounds then row upper bounds when root cuts saved
+    std::vector<double> rootUpper_;
+    /// Objective (times direction) when root cuts saved
+    std::vector<double> rootObjective_;
+    /// Cutoff when root cuts saved
+    double rootCutoff_;
+    /// Fingerprint at restorePseudoCosts or restoreRootCuts
+    CoinUInt64 modelFingerprint_;
+    /// Number of rows at restorePseudoCosts or restoreRootCuts
+    int modelNumberRows_;
+    /// Number of columns at restorePseudoCosts or restoreRootCuts (0 if not called)
+    int modelNumberColumns_;
+    /// Number of hits
+    int numberHits_;
+    /// Number of misses
+    int numberMisses_;
+    /// What was reused
+    int reused_[4];
+};
+
+#endif
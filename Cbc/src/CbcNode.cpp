@@ -48,6 +48,7 @@
 #include "CbcCountRowCut.hpp"
 #include "CbcFeasibilityBase.hpp"
 #include "CbcMessage.hpp"
+#include "CbcProfile.hpp"
 #ifdef COIN_HAS_CLP
 #include "OsiClpSolverInterface.hpp"
 #include "ClpSimplexOther.hpp"
@@ -252,7 +253,14 @@ CbcNode::createInfo (CbcModel *model,
           mean that we'll always generate a whack of diff entries because the expanded
           basis is considerably larger than the stripped basis.
         */
-        CoinWarmStartDiff *basisDiff = expanded->generateDiff(lastws) ;
+        /*
+          If compressed node bases are wanted (and no strategy which may build
+          its own node info from a diff) the diff is made inside CbcPartialNodeInfo.
+        */
+        bool compressBasis = (!strategy && model->compressNodeBases());
+        CoinWarmStartDiff *basisDiff = NULL;
+        if (!compressBasis)
+            basisDiff = expanded->generateDiff(lastws) ;
 
         /*
           Diff the bound vectors. It's assumed the number of structural variables
@@ -301,7 +309,15 @@ CbcNode::createInfo (CbcModel *model,
           Hand the lot over to the CbcPartialNodeInfo constructor, then clean up and
           return.
         */
-        if (!strategy) {
+        if (compressBasis) {
+	    delete nodeInfo_;
+            CbcPartialNodeInfo * info =
+                new CbcPartialNodeInfo(lastNode->nodeInfo_, this, numberChangedBounds,
+                                       variables, boundChanges, expanded, lastws) ;
+            model->addCompressedNodeBasis(info->compressedBasisBytes(),
+                                          info->uncompressedBasisBytes());
+            nodeInfo_ = info;
+        } else if (!strategy) {
 	    delete nodeInfo_;
             nodeInfo_ =
                 new CbcPartialNodeInfo(lastNode->nodeInfo_, this, numberChangedBounds,
@@ -535,6 +551,7 @@ CbcNode::createInfo (CbcModel *model,
 int CbcNode::chooseBranch (CbcModel *model, CbcNode *lastNode, int numberPassesLeft)
 
 {
+    CbcProfileTimer branchTimer(model->profile(), CBC_PROFILE_BRANCH);
     if (lastNode)
         depth_ = lastNode->depth_ + 1;
     else
@@ -1632,6 +1649,7 @@ int CbcNode::chooseDynamicBranch (CbcModel *model, CbcNode *lastNode,
                                   int numberPassesLeft)
 
 {
+    CbcProfileTimer branchTimer(model->profile(), CBC_PROFILE_BRANCH);
     if (lastNode)
         depth_ = lastNode->depth_ + 1;
     else
@@ -0,0 +1,424 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#include <windows.h> // for Sleep() and MemoryBarrier()
+#ifdef small
+#undef small
+#endif
+#else
+#include <unistd.h> // for usleep()
+#endif
+
+#include "CbcConfig.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinTime.hpp"
+#include "CbcNodeTrace.hpp"
+#ifdef CBC_THREAD
+#include <pthread.h>
+#endif
+
+// Identifies a trace file - change version if record changes
+#define CBC_TRACE_VERSION 1
+// Events in each ring (power of 2)
+#define CBC_TRACE_RING 4096
+
+namespace {
+// File header (32 bytes)
+typedef struct {
+    char magic[8];
+    int version;
+    int eventSize;
+    int numberThreads;
+    int spare;
+    double startTime;
+} CbcTraceHeader;
+
+// Read index written by another thread (and what it guards)
+inline unsigned int loadAcquire(const volatile unsigned int & index)
+{
+#if defined(__GNUC__)
+    return __atomic_load_n(&index, __ATOMIC_ACQUIRE);
+#else
+    unsigned int value = index;
+#if defined(_MSC_VER)
+    MemoryBarrier();
+#endif
+    return value;
+#endif
+}
+// Write index after what it guards
+inline void storeRelease(volatile unsigned int & index, unsigned int value)
+{
+#if defined(__GNUC__)
+    __atomic_store_n(&index, value, __ATOMIC_RELEASE);
+#else
+#if defined(_MSC_VER)
+    MemoryBarrier();
+#endif
+    index = value;
+#endif
+}
+
+// Reads header - returns 0 if ok, -1 if can not open, 1 if not trace
+int openTrace(const char * fileName, FILE *& fp, CbcTraceHeader & header)
+{
+    fp = fopen(fileName, "rb");
+    if (!fp)
+        return -1;
+    if (fread(&header, sizeof(header), 1, fp) != 1 ||
+            memcmp(header.magic, "CBCTRACE", 8) ||
+            header.version != CBC_TRACE_VERSION ||
+            header.eventSize != static_cast<int> (sizeof(CbcTraceEvent))) {
+        fclose(fp);
+        fp = NULL;
+        return 1;
+    }
+    return 0;
+}
+}
+
+#ifdef CBC_THREAD
+// Writer - empties rings until told to stop
+static void * doTraceWriter(void * voidTrace)
+{
+    CbcNodeTrace * trace = reinterpret_cast<CbcNodeTrace *> (voidTrace);
+    while (!trace->stopping()) {
+        trace->emptyRings();
+#ifdef _MSC_VER
+        Sleep(1);
+#else
+        usleep(1000);
+#endif
+    }
+    return NULL;
+}
+#endif
+
+// Constructor
+CbcNodeTrace::CbcNodeTrace (const char * fileName, int numberThreads)
+        : fp_(NULL),
+        ring_(NULL),
+        numberRings_(CoinMax(numberThreads, 0) + 1),
+        startTime_(CoinGetTimeOfDay()),
+        numberWritten_(0.0),
+        stop_(0),
+        writer_(false),
+        writerThread_(NULL)
+{
+    fp_ = fopen(fileName, "wb");
+    if (!fp_)
+        return;
+    CbcTraceHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, "CBCTRACE", 8);
+    header.version = CBC_TRACE_VERSION;
+    header.eventSize = static_cast<int> (sizeof(CbcTraceEvent));
+    header.numberThreads = numberRings_ - 1;
+    header.startTime = startTime_;
+    fwrite(&header, sizeof(header), 1, fp_);
+    ring_ = new CbcTraceRing [numberRings_];
+    memset(ring_, 0, numberRings_ * sizeof(CbcTraceRing));
+    for (int i = 0; i < numberRings_; i++)
+        ring_[i].events = new CbcTraceEvent [CBC_TRACE_RING];
+#ifdef CBC_THREAD
+    pthread_t * thread = new pthread_t;
+    if (!pthread_create(thread, NULL, doTraceWriter, this)) {
+        writer_ = true;
+        writerThread_ = thread;
+    } else {
+        delete thread;
+    }
+#endif
+}
+
+// Destructor
+CbcNodeTrace::~CbcNodeTrace ()
+{
+    if (!fp_)
+        return;
+#ifdef CBC_THREAD
+    if (writer_) {
+        storeRelease(stop_, 1);
+        pthread_t * thread = reinterpret_cast<pthread_t *> (writerThread_);
+        pthread_join(*thread, NULL);
+        delete thread;
+        writer_ = false;
+    }
+#endif
+    emptyRings();
+    CbcTraceEvent event;
+    memset(&event, 0, sizeof(event));
+    event.time = seconds();
+    event.node = -1;
+    event.parent = -1;
+    event.type = CBC_TRACE_END;
+    event.number = numberDropped();
+    fwrite(&event, sizeof(event), 1, fp_);
+    fclose(fp_);
+    for (int i = 0; i < numberRings_; i++)
+        delete [] ring_[i].events;
+    delete [] ring_;
+}
+
+// Seconds since trace was started
+double
+CbcNodeTrace::seconds() const
+{
+    return CoinGetTimeOfDay() - startTime_;
+}
+
+// True if writer should stop
+bool
+CbcNodeTrace::stopping() const
+{
+    return loadAcquire(stop_) != 0;
+}
+
+// Put an event in ring for thread
+void
+CbcNodeTrace::record(int thread, int type, int node, int parent, int depth,
+                     int number, int extra, double value, double duration)
+{
+    if (!fp_ || thread < 0 || thread >= numberRings_)
+        return;
+    CbcTraceRing & ring = ring_[thread];
+    unsigned int head = ring.head;
+    if (head - loadAcquire(ring.tail) >= CBC_TRACE_RING) {
+        if (writer_) {
+            // never wait for writer
+            ring.dropped++;
+            return;
+        }
+        emptyRing(thread);
+    }
+    CbcTraceEvent & event = ring.events[head & (CBC_TRACE_RING - 1)];
+    event.time = seconds();
+    event.value = value;
+    event.duration = duration;
+    event.node = node;
+    event.parent = parent;
+    event.depth = depth;
+    event.number = number;
+    event.extra = extra;
+    event.type = static_cast<short> (type);
+    event.thread = static_cast<short> (thread);
+    storeRelease(ring.head, head + 1);
+}
+
+// Events dropped as ring was full
+int
+CbcNodeTrace::numberDropped() const
+{
+    int n = 0;
+    for (int i = 0; i < numberRings_; i++)
+        n += ring_[i].dropped;
+    return n;
+}
+
+// Write out whatever is in ring
+void
+CbcNodeTrace::emptyRing(int iRing)
+{
+    CbcTraceRing & ring = ring_[iRing];
+    unsigned int head = loadAcquire(ring.head);
+    unsigned int tail = ring.tail;
+    while (tail != head) {
+        unsigned int start = tail & (CBC_TRACE_RING - 1);
+        unsigned int n = CoinMin(head - tail, CBC_TRACE_RING - start);
+        fwrite(ring.events + start, sizeof(CbcTraceEvent), n, fp_);
+        numberWritten_ += n;
+        tail += n;
+    }
+    storeRelease(ring.tail, tail);
+}
+
+// Write out all rings
+void
+CbcNodeTrace::emptyRings()
+{
+    for (int i = 0; i < numberRings_; i++)
+        emptyRing(i);
+}
+
+// Print summary of trace file
+int
+CbcNodeTrace::summarize(const char * fileName, FILE * fp)
+{
+    FILE * fpIn;
+    CbcTraceHeader header;
+    int returnCode = openTrace(fileName, fpIn, header);
+    if (returnCode)
+        return returnCode;
+    int numberThreads = header.numberThreads + 1;
+    // per thread - nodes, busy seconds, first and last time
+    std::vector<int> threadNodes(numberThreads, 0);
+    std::vector<double> threadBusy(numberThreads, 0.0);
+    std::vector<double> threadFirst(numberThreads, COIN_DBL_MAX);
+    std::vector<double> threadLast(numberThreads, 0.0);
+    // nodes created and leaves at each depth
+    std::vector<int> created;
+    std::vector<int> leaves;
+    // heuristics - calls, solutions, seconds
+    std::vector<int> heuristicCalls;
+    std::vector<int> heuristicSolutions;
+    std::vector<double> heuristicSeconds;
+    int numberEvents = 0;
+    int numberNodes = 0;
+    int numberBranches = 0;
+    int pruned[3] = {0, 0, 0};
+    double totalIterations = 0.0;
+    double totalCuts = 0.0;
+    double lastTime = 0.0;
+    int dropped = 0;
+    bool ended = false;
+    CbcTraceEvent events[256];
+    size_t n;
+    while ((n = fread(events, sizeof(CbcTraceEvent), 256, fpIn)) > 0) {
+        for (size_t k = 0; k < n; k++) {
+            const CbcTraceEvent & event = events[k];
+            numberEvents++;
+            lastTime = CoinMax(lastTime, event.time);
+            int iThread = event.thread;
+            if (iThread < 0 || iThread >= numberThreads)
+                iThread = 0;
+            int depth = CoinMax(event.depth, 0);
+            switch (event.type) {
+            case CBC_TRACE_NODE:
+                numberNodes++;
+                totalIterations += event.number;
+                totalCuts += event.extra;
+                threadNodes[iThread]++;
+                threadBusy[iThread] += event.duration;
+                threadFirst[iThread] = CoinMin(threadFirst[iThread],
+                                               event.time - event.duration);
+                threadLast[iThread] = CoinMax(threadLast[iThread], event.time);
+                break;
+            case CBC_TRACE_BRANCH:
+                numberBranches++;
+                if (depth >= static_cast<int> (created.size()))
+                    created.resize(depth + 1, 0);
+                created[depth]++;
+                break;
+            case CBC_TRACE_PRUNE:
+                if (event.number >= 0 && event.number < 3)
+                    pruned[event.number]++;
+                if (depth >= static_cast<int> (leaves.size()))
+                    leaves.resize(depth + 1, 0);
+                leaves[depth]++;
+                break;
+            case CBC_TRACE_HEURISTIC:
+                if (event.number >= 0) {
+                    if (event.number >= static_cast<int> (heuristicCalls.size())) {
+                        heuristicCalls.resize(event.number + 1, 0);
+                        heuristicSolutions.resize(event.number + 1, 0);
+                        heuristicSeconds.resize(event.number + 1, 0.0);
+                    }
+                    heuristicCalls[event.number]++;
+                    if (event.extra)
+                        heuristicSolutions[event.number]++;
+                    heuristicSeconds[event.number] += event.duration;
+                }
+                break;
+            case CBC_TRACE_END:
+                dropped = event.number;
+                ended = true;
+                break;
+            default:
+                break;
+            }
+        }
+    }
+    fclose(fpIn);
+    fprintf(fp, "Trace %s - %d events over %.2f seconds%s",
+            fileName, numberEvents, lastTime,
+            ended ? "" : " (incomplete - no end record)");
+    if (dropped)
+        fprintf(fp, ", %d events dropped", dropped);
+    fprintf(fp, "\n");
+    fprintf(fp, "%d nodes evaluated, %d created by branching, averaging %.1f iterations and %.1f cuts\n",
+            numberNodes, numberBranches,
+            numberNodes ? totalIterations / numberNodes : 0.0,
+            numberNodes ? totalCuts / numberNodes : 0.0);
+    fprintf(fp, "Pruned - %d infeasible, %d on bound, %d integer\n",
+            pruned[CBC_TRACE_INFEASIBLE], pruned[CBC_TRACE_CUTOFF],
+            pruned[CBC_TRACE_INTEGER]);
+    // tree shape - group depths so at most 25 lines
+    int maximumDepth = CoinMax(static_cast<int> (created.size()),
+                               static_cast<int> (leaves.size()));
+    created.resize(maximumDepth, 0);
+    leaves.resize(maximumDepth, 0);
+    if (maximumDepth) {
+        int step = (maximumDepth + 24) / 25;
+        fprintf(fp, "Maximum depth %d\n  depth     created      leaves\n",
+                maximumDepth - 1);
+        for (int i = 0; i < maximumDepth; i += step) {
+            int nCreated = 0;
+            int nLeaves = 0;
+            int last = CoinMin(i + step, maximumDepth) - 1;
+            for (int j = i; j <= last; j++) {
+                nCreated += created[j];
+                nLeaves += leaves[j];
+            }
+            if (last > i)
+                fprintf(fp, "%3d-%-3d %11d %11d\n", i, last, nCreated, nLeaves);
+            else
+                fprintf(fp, "%7d %11d %11d\n", i, nCreated, nLeaves);
+        }
+    }
+    for (int i = 0; i < static_cast<int> (heuristicCalls.size()); i++) {
+        if (heuristicCalls[i])
+            fprintf(fp, "Heuristic %d - %d calls, %d solutions, %.2f seconds\n",
+                    i, heuristicCalls[i], heuristicSolutions[i],
+                    heuristicSeconds[i]);
+    }
+    for (int i = 0; i < numberThreads; i++) {
+        if (!threadNodes[i])
+            continue;
+        double span = threadLast[i] - threadFirst[i];
+        fprintf(fp, "Thread %d - %d nodes, busy %.2f of %.2f seconds (%.1f%%)\n",
+                i, threadNodes[i], threadBusy[i], span,
+                span > 0.0 ? 100.0 * threadBusy[i] / span : 100.0);
+    }
+    return 0;
+}
+
+// Write trace file as comma separated values
+int
+CbcNodeTrace::writeCsv(const char * fileName, FILE * fp)
+{
+    FILE * fpIn;
+    CbcTraceHeader header;
+    int returnCode = openTrace(fileName, fpIn, header);
+    if (returnCode)
+        return returnCode;
+    static const char * typeName[] = {"node", "branch", "prune",
+                                      "heuristic", "end"
+                                     };
+    fprintf(fp, "time,thread,type,node,parent,depth,number,extra,value,duration\n");
+    CbcTraceEvent events[256];
+    size_t n;
+    while ((n = fread(events, sizeof(CbcTraceEvent), 256, fpIn)) > 0) {
+        for (size_t k = 0; k < n; k++) {
+            const CbcTraceEvent & event = events[k];
+            const char * name = (event.type >= 0 && event.type <= CBC_TRACE_END) ?
+                                typeName[event.type] : "unknown";
+            fprintf(fp, "%.6f,%d,%s,%d,%d,%d,%d,%d,%.12g,%.6f\n",
+                    event.time, event.thread, name, event.node, event.parent,
+                    event.depth, event.number, event.extra, event.value,
+                    event.duration);
+        }
+    }
+    fclose(fpIn);
+    return 0;
+}
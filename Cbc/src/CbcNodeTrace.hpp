@@ -0,0 +1,161 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CbcNodeTrace_H
+#define CbcNodeTrace_H
+
+#include <cstdio>
+
+/** Streaming trace of branch and bound events for analysis afterwards.
+
+    CbcStatistics keeps everything in memory and only prints at the end.
+    This writes fixed size binary records to a file while the search runs
+    so it can be left on for long runs.
+
+    Each search thread (0 is the main thread, i+1 thread i) has its own
+    ring buffer.  Only that thread puts events in and only the writer
+    takes them out, so no locks are needed - head and tail are just
+    written with release and read with acquire ordering.  With threads
+    (CBC_THREAD) a writer thread empties the rings to the file every
+    millisecond and if a ring is full the event is dropped (and counted)
+    rather than making the search wait.
+    Without threads a full ring is written out by the thread putting in.
+
+    File is a header (magic "CBCTRACE", version, record size, number of
+    threads) followed by records in native byte order.  Records from
+    different threads are not in time order.  The last record is an end
+    record with the number of dropped events.
+
+    summarize() and writeCsv() read a file - see examples/traceSummary.cpp.
+*/
+
+/// Type of trace event
+enum CbcTraceType {
+    /// branch of node evaluated by LP (number - iterations, extra - cuts, duration)
+    CBC_TRACE_NODE = 0,
+    /// node created by branching (number - variable, extra - unsatisfied)
+    CBC_TRACE_BRANCH,
+    /// branch of node pruned (depth of child, number - CbcTracePrune reason)
+    CBC_TRACE_PRUNE,
+    /// heuristic called (number - heuristic, extra - 1 if solution, duration)
+    CBC_TRACE_HEURISTIC,
+    /// end of trace (number - events dropped)
+    CBC_TRACE_END
+};
+
+/// Why a node was pruned
+enum CbcTracePrune {
+    CBC_TRACE_INFEASIBLE = 0,
+    CBC_TRACE_CUTOFF,
+    CBC_TRACE_INTEGER
+};
+
+/// One trace record (48 bytes)
+typedef struct {
+    /// Wall clock seconds since trace was started
+    double time;
+    /// Objective value (or heuristic solution value)
+    double value;
+    /// Seconds taken (node evaluation or heuristic)
+    double duration;
+    /// Node number (as in CbcStatistics)
+    int node;
+    /// Parent node number (-1 if none)
+    int parent;
+    /// Depth
+    int depth;
+    /// Depends on type
+    int number;
+    /// Depends on type
+    int extra;
+    /// CbcTraceType
+    short type;
+    /// Thread (0 main)
+    short thread;
+} CbcTraceEvent;
+
+class CbcNodeTrace {
+
+public:
+
+    /** Constructor - opens fileName and starts writer.
+        numberThreads is maximum number of search threads */
+    CbcNodeTrace (const char * fileName, int numberThreads = 0);
+
+    /// Destructor - writes out everything and closes file
+    ~CbcNodeTrace ();
+
+    /// True if file was opened
+    inline bool isOpen() const {
+        return fp_ != NULL;
+    }
+    /// Seconds since trace was started
+    double seconds() const;
+    /// Number of rings (search threads + 1)
+    inline int numberRings() const {
+        return numberRings_;
+    }
+    /** Put an event in ring for thread (stamped with time).
+        Must only be called from that thread */
+    void record(int thread, int type, int node, int parent, int depth,
+                int number, int extra, double value, double duration = 0.0);
+    /// Events dropped as ring was full
+    int numberDropped() const;
+    /// Events written so far
+    inline double numberWritten() const {
+        return numberWritten_;
+    }
+
+    /** Print summary of trace file - tree shape, pruning, heuristics and
+        time busy in each thread.
+        Returns 0 if ok, -1 if can not open, 1 if not a trace file */
+    static int summarize(const char * fileName, FILE * fp = stdout);
+    /** Write trace file as comma separated values.
+        Returns 0 if ok, -1 if can not open, 1 if not a trace file */
+    static int writeCsv(const char * fileName, FILE * fp = stdout);
+
+    /// Write out whatever is in ring (writer or owning thread only)
+    void emptyRing(int iRing);
+    /// Write out all rings (writer only)
+    void emptyRings();
+    /// True if writer should stop
+    bool stopping() const;
+
+private:
+    /// Illegal
+    CbcNodeTrace (const CbcNodeTrace &);
+    CbcNodeTrace & operator=(const CbcNodeTrace &);
+
+    /// One ring per thread - padded so threads do not share cache lines
+    typedef struct {
+        CbcTraceEvent * events;
+        /// Next to put in (only changed by owning thread)
+        volatile unsigned int head;
+        /// Next to take out (only changed by writer)
+        volatile unsigned int tail;
+        /// Dropped as full
+        int dropped;
+        char pad[44];
+    } CbcTraceRing;
+
+    /// File
+    FILE * fp_;
+    /// Rings
+    CbcTraceRing * ring_;
+    /// Number of rings
+    int numberRings_;
+    /// Wall clock at start
+    double startTime_;
+    /// Events written
+    double numberWritten_;
+    /// Set to stop writer
+    volatile unsigned int stop_;
+    /// True if there is a writer thread
+    bool writer_;
+    /// Writer thread (pthread_t)
+    void * writerThread_;
+};
+
+#endif
@@ -41,11 +41,97 @@
 using namespace std;
 #include "CglCutGenerator.hpp"
 
+namespace {
+/*
+  Helpers for compressed basis changes. A status word holds 16 two bit
+  statuses. Words are xor'ed with a typical word (all basic for rows, all
+  at lower bound for columns) so that common words become small numbers,
+  and then stored as varints. Changed words are grouped into runs and the
+  start of each run is stored as a gap from the end of the previous run.
+
+  Layout - varint (2*numberWords+all), then for artificials and then
+  structurals - varint numberRuns, then per run varint gap, varint length
+  and length varints of masked words.
+*/
+const unsigned int artificialMask = 0x55555555;
+const unsigned int structuralMask = 0xffffffff;
+
+void addVarint(std::vector<unsigned char> & buffer, unsigned int value)
+{
+    while (value >= 0x80) {
+        buffer.push_back(static_cast<unsigned char>(value | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<unsigned char>(value));
+}
+
+unsigned int getVarint(const unsigned char *& data)
+{
+    unsigned int value = 0;
+    int shift = 0;
+    while ((*data & 0x80) != 0) {
+        value |= static_cast<unsigned int>(*data & 0x7f) << shift;
+        shift += 7;
+        data++;
+    }
+    value |= static_cast<unsigned int>(*data) << shift;
+    data++;
+    return value;
+}
+
+// Number of words generateDiff would see as changed
+int countChanged(const unsigned int * newStatus, int sizeNew,
+                 const unsigned int * oldStatus, int sizeOld)
+{
+    int numberChanged = sizeNew - sizeOld;
+    for (int i = 0; i < sizeOld; i++) {
+        if (newStatus[i] != oldStatus[i])
+            numberChanged++;
+    }
+    return numberChanged;
+}
+
+// Add runs of changed words (all words if all true)
+void addSection(std::vector<unsigned char> & buffer,
+                const unsigned int * newStatus, int sizeNew,
+                const unsigned int * oldStatus, int sizeOld,
+                unsigned int mask, bool all)
+{
+    std::vector<int> runs;
+    int i = 0;
+    while (i < sizeNew) {
+        if (!all && i < sizeOld && newStatus[i] == oldStatus[i]) {
+            i++;
+            continue;
+        }
+        int start = i;
+        while (i < sizeNew && (all || i >= sizeOld || newStatus[i] != oldStatus[i]))
+            i++;
+        runs.push_back(start);
+        runs.push_back(i - start);
+    }
+    int numberRuns = static_cast<int>(runs.size()) >> 1;
+    addVarint(buffer, numberRuns);
+    int last = 0;
+    for (int k = 0; k < numberRuns; k++) {
+        int start = runs[2*k];
+        int length = runs[2*k+1];
+        addVarint(buffer, start - last);
+        addVarint(buffer, length);
+        for (int j = start; j < start + length; j++)
+            addVarint(buffer, newStatus[j] ^ mask);
+        last = start + length;
+    }
+}
+} // end file-local namespace
+
 // Default constructor
 CbcPartialNodeInfo::CbcPartialNodeInfo()
 
         : CbcNodeInfo(),
         basisDiff_(NULL),
+        compressedBasis_(NULL),
+        compressedBasisBytes_(0),
         variables_(NULL),
         newBounds_(NULL),
         numberChangedBounds_(0)
@@ -61,6 +147,8 @@ CbcPartialNodeInfo::CbcPartialNodeInfo (CbcNodeInfo *parent, CbcNode *owner,
         : CbcNodeInfo(parent, owner)
 {
     basisDiff_ = basisDiff->clone() ;
+    compressedBasis_ = NULL;
+    compressedBasisBytes_ = 0;
 #ifdef CBC_CHECK_BASIS
     std::cout << "Constructor (" << this << ") " << std::endl ;
 #endif
@@ -78,12 +166,72 @@ CbcPartialNodeInfo::CbcPartialNodeInfo (CbcNodeInfo *parent, CbcNode *owner,
     }
 }
 
+// Constructor from current state with compressed basis change
+CbcPartialNodeInfo::CbcPartialNodeInfo (CbcNodeInfo *parent, CbcNode *owner,
+                                        int numberChangedBounds,
+                                        const int *variables,
+                                        const double *boundChanges,
+                                        const CoinWarmStartBasis *basis,
+                                        const CoinWarmStartBasis *lastBasis)
+        : CbcNodeInfo(parent, owner)
+{
+    basisDiff_ = NULL;
+    /*
+      Same positional comparison as CoinWarmStartBasis::generateDiff. If more
+      than half the words differ generateDiff keeps the full basis - so we
+      store every word.
+    */
+    assert (basis->getNumArtificial() >= lastBasis->getNumArtificial());
+    assert (basis->getNumStructural() >= lastBasis->getNumStructural());
+    int sizeOldArtif = (lastBasis->getNumArtificial() + 15) >> 4;
+    int sizeNewArtif = (basis->getNumArtificial() + 15) >> 4;
+    int sizeOldStruct = (lastBasis->getNumStructural() + 15) >> 4;
+    int sizeNewStruct = (basis->getNumStructural() + 15) >> 4;
+    const unsigned int * oldArtif =
+        reinterpret_cast<const unsigned int *>(lastBasis->getArtificialStatus());
+    const unsigned int * newArtif =
+        reinterpret_cast<const unsigned int *>(basis->getArtificialStatus());
+    const unsigned int * oldStruct =
+        reinterpret_cast<const unsigned int *>(lastBasis->getStructuralStatus());
+    const unsigned int * newStruct =
+        reinterpret_cast<const unsigned int *>(basis->getStructuralStatus());
+    int numberChanged = countChanged(newArtif, sizeNewArtif, oldArtif, sizeOldArtif) +
+                        countChanged(newStruct, sizeNewStruct, oldStruct, sizeOldStruct);
+    int maxBasisLength = sizeNewArtif + sizeNewStruct;
+    bool all = (2 * numberChanged > maxBasisLength);
+    if (all)
+        numberChanged = maxBasisLength;
+    std::vector<unsigned char> buffer;
+    buffer.reserve(8 + 2 * numberChanged);
+    addVarint(buffer, (numberChanged << 1) | (all ? 1 : 0));
+    addSection(buffer, newArtif, sizeNewArtif, oldArtif, sizeOldArtif,
+               artificialMask, all);
+    addSection(buffer, newStruct, sizeNewStruct, oldStruct, sizeOldStruct,
+               structuralMask, all);
+    compressedBasisBytes_ = static_cast<int>(buffer.size());
+    compressedBasis_ = CoinCopyOfArray(&buffer[0], compressedBasisBytes_);
+
+    numberChangedBounds_ = numberChangedBounds;
+    size_t size = numberChangedBounds_ * (sizeof(double) + sizeof(int));
+    char * temp = new char [size];
+    newBounds_ = reinterpret_cast<double *> (temp);
+    variables_ = reinterpret_cast<int *> (newBounds_ + numberChangedBounds_);
+
+    int i ;
+    for (i = 0; i < numberChangedBounds_; i++) {
+        variables_[i] = variables[i];
+        newBounds_[i] = boundChanges[i];
+    }
+}
+
 CbcPartialNodeInfo::CbcPartialNodeInfo (const CbcPartialNodeInfo & rhs)
 
         : CbcNodeInfo(rhs)
 
 {
-    basisDiff_ = rhs.basisDiff_->clone() ;
+    basisDiff_ = rhs.basisDiff_ ? rhs.basisDiff_->clone() : NULL ;
+    compressedBasisBytes_ = rhs.compressedBasisBytes_;
+    compressedBasis_ = CoinCopyOfArray(rhs.compressedBasis_, compressedBasisBytes_);
 
 #ifdef CBC_CHECK_BASIS
     std::cout << "Copy constructor (" << this << ") from " << this << std::endl ;
@@ -111,9 +259,53 @@ CbcPartialNodeInfo::clone() const
 CbcPartialNodeInfo::~CbcPartialNodeInfo ()
 {
     delete basisDiff_ ;
+    delete [] compressedBasis_;
     delete [] newBounds_;
 }
 
+// Bytes an uncompressed CoinWarmStartBasisDiff would have used
+int
+CbcPartialNodeInfo::uncompressedBasisBytes() const
+{
+    if (!compressedBasis_)
+        return 0;
+    const unsigned char * data = compressedBasis_;
+    unsigned int header = getVarint(data);
+    int numberWords = static_cast<int>(header >> 1);
+    // full basis is one copy of words - otherwise index and value
+    int perWord = (header & 1) ? 1 : 2;
+    return static_cast<int>(sizeof(CoinWarmStartBasisDiff)) +
+           perWord * numberWords * static_cast<int>(sizeof(unsigned int));
+}
+
+// Decode compressed basis change and apply to basis
+void
+CbcPartialNodeInfo::applyCompressedBasis(CoinWarmStartBasis & basis) const
+{
+    const unsigned char * data = compressedBasis_;
+    getVarint(data); // skip header
+    for (int iSection = 0; iSection < 2; iSection++) {
+        unsigned int * status;
+        unsigned int mask;
+        if (!iSection) {
+            status = reinterpret_cast<unsigned int *>(basis.getArtificialStatus());
+            mask = artificialMask;
+        } else {
+            status = reinterpret_cast<unsigned int *>(basis.getStructuralStatus());
+            mask = structuralMask;
+        }
+        int numberRuns = static_cast<int>(getVarint(data));
+        int last = 0;
+        for (int k = 0; k < numberRuns; k++) {
+            int start = last + static_cast<int>(getVarint(data));
+            int length = static_cast<int>(getVarint(data));
+            for (int j = start; j < start + length; j++)
+                status[j] = getVarint(data) ^ mask;
+            last = start + length;
+        }
+    }
+}
+
 
 /**
    The basis supplied as a parameter is incrementally modified, and lower and
@@ -129,7 +321,10 @@ void CbcPartialNodeInfo::applyToModel (CbcModel *model,
 {
     OsiSolverInterface *solver = model->solver();
     if ((active_&4) != 0 && basis) {
-        basis->applyDiff(basisDiff_) ;
+        if (basisDiff_)
+            basis->applyDiff(basisDiff_) ;
+        else
+            applyCompressedBasis(*basis);
 #ifdef CBC_CHECK_BASIS
         std::cout << "Basis (after applying " << this << ") " << std::endl ;
         basis->print() ;
@@ -279,7 +474,10 @@ CbcNodeInfo *
 CbcPartialNodeInfo::buildRowBasis(CoinWarmStartBasis & basis ) const
 
 {
-    basis.applyDiff(basisDiff_) ;
+    if (basisDiff_)
+        basis.applyDiff(basisDiff_) ;
+    else
+        applyCompressedBasis(basis);
 
     return parent_ ;
 }
@@ -65,6 +65,17 @@ public:
                         const double * boundChanges,
                         const CoinWarmStartDiff *basisDiff) ;
 
+    /** Constructor from current state keeping basis change in compressed form.
+        The difference of basis against lastBasis (same positional layout as
+        for generateDiff) is packed as runs of changed status words with
+        delta coded positions and only decoded in applyToModel.
+    */
+    CbcPartialNodeInfo (CbcNodeInfo * parent, CbcNode * owner,
+                        int numberChangedBounds, const int * variables,
+                        const double * boundChanges,
+                        const CoinWarmStartBasis * basis,
+                        const CoinWarmStartBasis * lastBasis) ;
+
     // Copy constructor
     CbcPartialNodeInfo ( const CbcPartialNodeInfo &);
 
@@ -73,10 +84,16 @@ public:
 
     /// Clone
     virtual CbcNodeInfo * clone() const;
-    /// Basis diff information
+    /// Basis diff information (NULL if basis change is compressed)
     inline const CoinWarmStartDiff *basisDiff() const {
         return basisDiff_ ;
     }
+    /// Bytes used by compressed basis change (0 if not compressed)
+    inline int compressedBasisBytes() const {
+        return compressedBasisBytes_;
+    }
+    /// Bytes an uncompressed CoinWarmStartBasisDiff would have used
+    int uncompressedBasisBytes() const;
     /// Which variable (top bit if upper bound changing)
     inline const int * variables() const {
         return variables_;
@@ -94,6 +111,10 @@ protected:
 
     /// Basis diff information
     CoinWarmStartDiff *basisDiff_ ;
+    /// Compressed basis change (used if basisDiff_ NULL)
+    unsigned char * compressedBasis_;
+    /// Number of bytes in compressedBasis_
+    int compressedBasisBytes_;
     /// Which variable (top bit if upper bound changing)
     int * variables_;
     // New bound
@@ -102,6 +123,9 @@ protected:
     int numberChangedBounds_;
 private:
 
+    /// Decode compressed basis change and apply to basis
+    void applyCompressedBasis(CoinWarmStartBasis & basis) const;
+
     /// Illegal Assignment operator
     CbcPartialNodeInfo & operator=(const CbcPartialNodeInfo& rhs);
 };
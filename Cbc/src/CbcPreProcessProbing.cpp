@@ -0,0 +1,329 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <cassert>
+#include <cmath>
+#include <cfloat>
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinTime.hpp"
+#include "OsiSolverInterface.hpp"
+#include "OsiCuts.hpp"
+#include "CbcModel.hpp"
+#include "CbcMessage.hpp"
+#include "CbcPreProcessProbing.hpp"
+#ifdef CBC_THREAD
+#include "CbcThread.hpp"
+#endif
+
+// Fewest integer variables worth giving a thread
+#define CBC_PARALLEL_PROBING_MINIMUM 500
+
+namespace {
+typedef struct {
+    const OsiSolverInterface * solver;
+    const CglProbing * probing;
+    const CglTreeInfo * info;
+    const int * whichThread; // for each column thread or -1
+    int iThread;
+    OsiCuts cuts;
+} CbcProbingThreadInfo;
+/*
+  Probe on a copy of solver with integer variables not owned by this
+  thread made continuous.
+*/
+void * doProbingThread(void * voidInfo)
+{
+    CbcProbingThreadInfo * info = reinterpret_cast<CbcProbingThreadInfo *>(voidInfo);
+    OsiSolverInterface * solver = info->solver->clone();
+    int numberColumns = solver->getNumCols();
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+        int iThread = info->whichThread[iColumn];
+        if (iThread >= 0 && iThread != info->iThread)
+            solver->setContinuous(iColumn);
+    }
+    CglProbing probing(*info->probing);
+    probing.generateCuts(*solver, info->cuts, *info->info);
+    delete solver;
+    return NULL;
+}
+}
+
+// Default Constructor
+CbcPreProcessProbing::CbcPreProcessProbing ()
+        : CglCutGenerator(),
+        model_(NULL),
+        maximumSeconds_(0.0),
+        startTime_(CoinGetTimeOfDay()),
+        numberThreads_(1),
+        budgetExceeded_(false)
+{
+}
+
+// Useful constructor
+CbcPreProcessProbing::CbcPreProcessProbing (const CglProbing & probing,
+        CbcModel * model,
+        double maximumSeconds, int numberThreads)
+        : CglCutGenerator(),
+        probing_(probing),
+        model_(model),
+        maximumSeconds_(maximumSeconds),
+        startTime_(CoinGetTimeOfDay()),
+        numberThreads_(numberThreads),
+        budgetExceeded_(false)
+{
+}
+
+// Copy constructor
+CbcPreProcessProbing::CbcPreProcessProbing ( const CbcPreProcessProbing & rhs)
+        : CglCutGenerator(rhs),
+        probing_(rhs.probing_),
+        model_(rhs.model_),
+        maximumSeconds_(rhs.maximumSeconds_),
+        startTime_(rhs.startTime_),
+        numberThreads_(rhs.numberThreads_),
+        budgetExceeded_(rhs.budgetExceeded_),
+        passBounds_(rhs.passBounds_),
+        passCuts_(rhs.passCuts_),
+        passTime_(rhs.passTime_),
+        passThreads_(rhs.passThreads_)
+{
+}
+
+// Clone
+CglCutGenerator *
+CbcPreProcessProbing::clone() const
+{
+    return new CbcPreProcessProbing(*this);
+}
+
+// Assignment operator
+CbcPreProcessProbing &
+CbcPreProcessProbing::operator=( const CbcPreProcessProbing & rhs)
+{
+    if (this != &rhs) {
+        CglCutGenerator::operator=(rhs);
+        probing_ = rhs.probing_;
+        model_ = rhs.model_;
+        maximumSeconds_ = rhs.maximumSeconds_;
+        startTime_ = rhs.startTime_;
+        numberThreads_ = rhs.numberThreads_;
+        budgetExceeded_ = rhs.budgetExceeded_;
+        passBounds_ = rhs.passBounds_;
+        passCuts_ = rhs.passCuts_;
+        passTime_ = rhs.passTime_;
+        passThreads_ = rhs.passThreads_;
+    }
+    return *this;
+}
+
+// Destructor
+CbcPreProcessProbing::~CbcPreProcessProbing ()
+{
+}
+
+// Set budget and restart clock
+void
+CbcPreProcessProbing::setMaximumSeconds(double value)
+{
+    maximumSeconds_ = value;
+    startTime_ = CoinGetTimeOfDay();
+    budgetExceeded_ = false;
+}
+
+// Pass on new solver
+void
+CbcPreProcessProbing::refreshSolver(OsiSolverInterface * solver)
+{
+    probing_.refreshSolver(solver);
+}
+
+// One pass of probing
+void
+CbcPreProcessProbing::generateCuts(const OsiSolverInterface & si, OsiCuts & cs,
+                                   const CglTreeInfo info)
+{
+    double time1 = CoinGetTimeOfDay();
+    if (maximumSeconds_ > 0.0 && time1 - startTime_ > maximumSeconds_)
+        budgetExceeded_ = true;
+    if (budgetExceeded_) {
+        // no changes so CglPreProcess will stop
+        passBounds_.push_back(-1);
+        passCuts_.push_back(0);
+        passTime_.push_back(0.0);
+        passThreads_.push_back(0);
+        return;
+    }
+    int numberColumns = si.getNumCols();
+    int numberIntegers = 0;
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+        if (si.isInteger(iColumn))
+            numberIntegers++;
+    }
+    int numberThreads = 1;
+#ifdef CBC_THREAD
+    numberThreads = CoinMin(numberThreads_,
+                            numberIntegers / CBC_PARALLEL_PROBING_MINIMUM);
+    numberThreads = CoinMax(numberThreads, 1);
+#endif
+    CbcProbingThreadInfo * threadInfo = new CbcProbingThreadInfo [numberThreads];
+    if (numberThreads == 1) {
+        probing_.generateCuts(si, threadInfo[0].cuts, info);
+    } else {
+#ifdef CBC_THREAD
+        // deal integers out so each thread gets a spread of them
+        int * whichThread = new int [numberColumns];
+        int iThread = 0;
+        for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+            if (si.isInteger(iColumn)) {
+                whichThread[iColumn] = iThread;
+                iThread = (iThread + 1) % numberThreads;
+            } else {
+                whichThread[iColumn] = -1;
+            }
+        }
+        Coin_pthread_t * threadId = new Coin_pthread_t [numberThreads];
+        for (int i = 0; i < numberThreads; i++) {
+            threadInfo[i].solver = &si;
+            threadInfo[i].probing = &probing_;
+            threadInfo[i].info = &info;
+            threadInfo[i].whichThread = whichThread;
+            threadInfo[i].iThread = i;
+            pthread_create(&(threadId[i].thr), NULL, doProbingThread, threadInfo + i);
+        }
+        for (int i = 0; i < numberThreads; i++)
+            pthread_join(threadId[i].thr, NULL);
+        delete [] threadId;
+        delete [] whichThread;
+#endif
+    }
+    // merge - tightest bounds go in one column cut
+    const double * lower = si.getColLower();
+    const double * upper = si.getColUpper();
+    double * newLower = CoinCopyOfArray(lower, numberColumns);
+    double * newUpper = CoinCopyOfArray(upper, numberColumns);
+    int numberCuts = 0;
+    for (int i = 0; i < numberThreads; i++) {
+        OsiCuts & cuts = threadInfo[i].cuts;
+        for (int k = 0; k < cuts.sizeColCuts(); k++) {
+            const OsiColCut * thisCut = cuts.colCutPtr(k);
+            const CoinPackedVector & lbs = thisCut->lbs();
+            const int * which = lbs.getIndices();
+            const double * values = lbs.getElements();
+            for (int j = 0; j < lbs.getNumElements(); j++) {
+                int iColumn = which[j];
+                newLower[iColumn] = CoinMax(newLower[iColumn], values[j]);
+            }
+            const CoinPackedVector & ubs = thisCut->ubs();
+            which = ubs.getIndices();
+            values = ubs.getElements();
+            for (int j = 0; j < ubs.getNumElements(); j++) {
+                int iColumn = which[j];
+                newUpper[iColumn] = CoinMin(newUpper[iColumn], values[j]);
+            }
+        }
+        for (int k = 0; k < cuts.sizeRowCuts(); k++) {
+            cs.insert(cuts.rowCut(k));
+            numberCuts++;
+        }
+    }
+    delete [] threadInfo;
+    int * which = new int [numberColumns];
+    int nLower = 0;
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+        if (newLower[iColumn] > lower[iColumn] + 1.0e-8) {
+            which[nLower] = iColumn;
+            newLower[nLower++] = newLower[iColumn];
+        }
+    }
+    OsiColCut cc;
+    if (nLower)
+        cc.setLbs(nLower, which, newLower);
+    int nUpper = 0;
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+        if (newUpper[iColumn] < upper[iColumn] - 1.0e-8) {
+            which[nUpper] = iColumn;
+            newUpper[nUpper++] = newUpper[iColumn];
+        }
+    }
+    if (nUpper)
+        cc.setUbs(nUpper, which, newUpper);
+    if (nLower + nUpper)
+        cs.insert(cc);
+    delete [] which;
+    delete [] newLower;
+    delete [] newUpper;
+    passBounds_.push_back(nLower + nUpper);
+    passCuts_.push_back(numberCuts);
+    passTime_.push_back(CoinGetTimeOfDay() - time1);
+    passThreads_.push_back(numberThreads);
+}
+
+// Print one line per pass and a total
+void
+CbcPreProcessProbing::report() const
+{
+    if (!model_ || model_->messageHandler()->logLevel() < 1)
+        return;
+    CoinMessageHandler * handler = model_->messageHandler();
+    char general[200];
+    int numberPasses = static_cast<int> (passTime_.size());
+    int totalBounds = 0;
+    int totalCuts = 0;
+    double totalTime = 0.0;
+    int numberSkipped = 0;
+    for (int i = 0; i < numberPasses; i++) {
+        if (passBounds_[i] < 0) {
+            numberSkipped++;
+            continue;
+        }
+        totalBounds += passBounds_[i];
+        totalCuts += passCuts_[i];
+        totalTime += passTime_[i];
+        sprintf(general, "Preprocess probing pass %d - %d bounds tightened, %d cuts in %.2f seconds (%d threads)",
+                i + 1, passBounds_[i], passCuts_[i], passTime_[i], passThreads_[i]);
+        handler->message(CBC_GENERAL, model_->messages())
+        << general << CoinMessageEol;
+    }
+    if (numberSkipped) {
+        sprintf(general, "Preprocess probing - %d passes skipped as time budget of %g seconds used",
+                numberSkipped, maximumSeconds_);
+        handler->message(CBC_GENERAL, model_->messages())
+        << general << CoinMessageEol;
+    }
+    sprintf(general, "Preprocess probing - %d bounds tightened, %d cuts in %.2f seconds, %.2f seconds since start",
+            totalBounds, totalCuts, totalTime, CoinGetTimeOfDay() - startTime_);
+    handler->message(CBC_GENERAL, model_->messages())
+    << general << CoinMessageEol;
+}
+
+// True if worth using instead of plain CglProbing
+bool
+CbcPreProcessProbing::wanted(const OsiSolverInterface & solver,
+                             double maximumSeconds, int numberThreads)
+{
+    if (maximumSeconds > 0.0)
+        return true;
+#ifdef CBC_THREAD
+    if (numberThreads > 1) {
+        int numberColumns = solver.getNumCols();
+        int numberIntegers = 0;
+        for (int iColumn = 0; iColumn < numberColumns; iColumn++) {
+            if (solver.isInteger(iColumn))
+                numberIntegers++;
+        }
+        // same test as generateCuts
+        return numberIntegers >= 2 * CBC_PARALLEL_PROBING_MINIMUM;
+    }
+#endif
+    return false;
+}
@@ -0,0 +1,123 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CbcPreProcessProbing_H
+#define CbcPreProcessProbing_H
+
+#include <vector>
+#include "CglCutGenerator.hpp"
+#include "CglProbing.hpp"
+
+class CbcModel;
+
+/** Probing for CglPreProcess with a time budget and threads.
+
+    Wraps a CglProbing and is added to CglPreProcess instead of it.  Each
+    call is one preprocessing pass.  Once wall clock time since construction
+    (or setMaximumSeconds) goes over the budget no more probing is done, so
+    the pass makes no changes and CglPreProcess stops.
+
+    With more than one thread the integer variables are split into disjoint
+    sets and each thread probes its set on a copy of the solver in which
+    the other integer variables are continuous.  That is a relaxation so
+    anything found is valid.  Bounds found are merged into one column cut.
+
+    Reductions and time of each pass are kept and can be reported.
+
+    Unlike a plain CglProbing, CglPreProcess can not use this to strengthen
+    coefficients, so it should only be used when a budget is set or threads
+    will really be used (see wanted).
+*/
+
+class CbcPreProcessProbing : public CglCutGenerator {
+
+public:
+
+    // Default Constructor
+    CbcPreProcessProbing ();
+
+    /** Useful constructor - probing is copied.
+        model is only used for messages and may be NULL */
+    CbcPreProcessProbing (const CglProbing & probing, CbcModel * model,
+                          double maximumSeconds = 0.0, int numberThreads = 1);
+
+    // Copy constructor
+    CbcPreProcessProbing ( const CbcPreProcessProbing &);
+
+    /// Clone
+    virtual CglCutGenerator * clone() const;
+
+    // Assignment operator
+    CbcPreProcessProbing & operator=( const CbcPreProcessProbing& rhs);
+
+    // Destructor
+    virtual ~CbcPreProcessProbing ();
+
+    /// Probe (one pass of preprocessing)
+    virtual void generateCuts( const OsiSolverInterface & si, OsiCuts & cs,
+                               const CglTreeInfo info = CglTreeInfo());
+
+    /// Pass on new solver
+    virtual void refreshSolver(OsiSolverInterface * solver);
+
+    /// Print one line per pass and a total
+    void report() const;
+
+    /** True if worth using instead of plain CglProbing on this solver -
+        a budget is set or there are enough integers for threads */
+    static bool wanted(const OsiSolverInterface & solver,
+                       double maximumSeconds, int numberThreads);
+
+    /// Set wall clock budget in seconds (0.0 no budget) - restarts clock
+    void setMaximumSeconds(double value);
+    /// Wall clock budget in seconds (0.0 no budget)
+    inline double maximumSeconds() const {
+        return maximumSeconds_;
+    }
+    /// Set number of threads
+    inline void setNumberThreads(int value) {
+        numberThreads_ = value;
+    }
+    /// Number of threads
+    inline int numberThreads() const {
+        return numberThreads_;
+    }
+    /// Probing used
+    inline CglProbing * probing() {
+        return &probing_;
+    }
+    /// Number of passes made (including those skipped)
+    inline int numberPasses() const {
+        return static_cast<int> (passTime_.size());
+    }
+    /// True if budget stopped probing
+    inline bool budgetExceeded() const {
+        return budgetExceeded_;
+    }
+
+private:
+    /// Probing settings
+    CglProbing probing_;
+    /// Model for messages (not owned)
+    CbcModel * model_;
+    /// Wall clock budget (0.0 none)
+    double maximumSeconds_;
+    /// Wall clock time at start
+    double startTime_;
+    /// Number of threads
+    int numberThreads_;
+    /// True if budget stopped probing
+    bool budgetExceeded_;
+    /// Bounds changed in each pass (-1 if skipped)
+    std::vector<int> passBounds_;
+    /// Row cuts in each pass
+    std::vector<int> passCuts_;
+    /// Wall clock time of each pass
+    std::vector<double> passTime_;
+    /// Threads used in each pass
+    std::vector<int> passThreads_;
+};
+
+#endif
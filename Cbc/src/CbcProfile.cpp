@@ -0,0 +1,203 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+#include "CoinHelperFunctions.hpp"
+#include "CbcModel.hpp"
+#include "CbcCutGenerator.hpp"
+#include "CbcHeuristic.hpp"
+#include "CbcProfile.hpp"
+
+namespace {
+const char * sectionNames[CBC_PROFILE_NUMBER] = {
+    "node", "branch", "cutLoop", "resolve", "addCuts", "heuristic",
+    "propagation", "tree"
+};
+// Append name as JSON string
+void appendString(std::string & json, const char * name)
+{
+    json += '"';
+    for (const char * c = name; c && *c; c++) {
+        if (*c == '"' || *c == '\\')
+            json += '\\';
+        if (static_cast<unsigned char> (*c) >= 32)
+            json += *c;
+    }
+    json += '"';
+}
+// Append "name":value
+void appendNumber(std::string & json, const char * name, double value,
+                  bool comma = true)
+{
+    char temp[100];
+    sprintf(temp, "\"%s\":%.12g%s", name, value, comma ? "," : "");
+    json += temp;
+}
+// Append {"node":{"calls":..,"seconds":..},...}
+void appendSections(std::string & json, const double * calls,
+                    const double * seconds)
+{
+    json += '{';
+    for (int i = 0; i < CBC_PROFILE_NUMBER; i++) {
+        appendString(json, sectionNames[i]);
+        json += ":{";
+        appendNumber(json, "calls", calls[i]);
+        appendNumber(json, "seconds", seconds[i], false);
+        json += (i < CBC_PROFILE_NUMBER - 1) ? "}," : "}";
+    }
+    json += '}';
+}
+}
+
+// Default Constructor
+CbcProfile::CbcProfile ()
+{
+    reset();
+}
+
+// Copy constructor
+CbcProfile::CbcProfile ( const CbcProfile & rhs)
+        : threadCalls_(rhs.threadCalls_),
+        threadSeconds_(rhs.threadSeconds_),
+        report_(rhs.report_)
+{
+    memcpy(calls_, rhs.calls_, sizeof(calls_));
+    memcpy(seconds_, rhs.seconds_, sizeof(seconds_));
+}
+
+// Assignment operator
+CbcProfile &
+CbcProfile::operator=( const CbcProfile & rhs)
+{
+    if (this != &rhs) {
+        memcpy(calls_, rhs.calls_, sizeof(calls_));
+        memcpy(seconds_, rhs.seconds_, sizeof(seconds_));
+        threadCalls_ = rhs.threadCalls_;
+        threadSeconds_ = rhs.threadSeconds_;
+        report_ = rhs.report_;
+    }
+    return *this;
+}
+
+// Destructor
+CbcProfile::~CbcProfile ()
+{
+}
+
+// Zero everything
+void
+CbcProfile::reset()
+{
+    memset(calls_, 0, sizeof(calls_));
+    memset(seconds_, 0, sizeof(seconds_));
+    threadCalls_.clear();
+    threadSeconds_.clear();
+    report_ = "";
+}
+
+// Name of section
+const char *
+CbcProfile::sectionName(int section)
+{
+    if (section >= 0 && section < CBC_PROFILE_NUMBER)
+        return sectionNames[section];
+    else
+        return "";
+}
+
+// Section from name
+int
+CbcProfile::section(const char * name)
+{
+    for (int i = 0; i < CBC_PROFILE_NUMBER; i++) {
+        if (name && !strcmp(name, sectionNames[i]))
+            return i;
+    }
+    return -1;
+}
+
+// Add in profile of a thread
+void
+CbcProfile::addThread(const CbcProfile & rhs)
+{
+    for (int i = 0; i < CBC_PROFILE_NUMBER; i++) {
+        calls_[i] += rhs.calls_[i];
+        seconds_[i] += rhs.seconds_[i];
+        threadCalls_.push_back(rhs.calls_[i]);
+        threadSeconds_.push_back(rhs.seconds_[i]);
+    }
+}
+
+// Make report as JSON
+void
+CbcProfile::makeReport(const CbcModel * model)
+{
+    std::string json = "{";
+    appendNumber(json, "seconds", model->getCurrentSeconds());
+    appendNumber(json, "nodes", model->getNodeCount());
+    appendNumber(json, "iterations", model->getIterationCount());
+    appendNumber(json, "strongIterations", model->numberStrongIterations());
+    json += "\"sections\":";
+    appendSections(json, calls_, seconds_);
+    int numberThreads = this->numberThreads();
+    if (numberThreads) {
+        // main thread is what is left
+        double calls[CBC_PROFILE_NUMBER];
+        double seconds[CBC_PROFILE_NUMBER];
+        memcpy(calls, calls_, sizeof(calls));
+        memcpy(seconds, seconds_, sizeof(seconds));
+        for (int j = 0; j < numberThreads; j++) {
+            for (int i = 0; i < CBC_PROFILE_NUMBER; i++) {
+                calls[i] -= threadCalls_[j*CBC_PROFILE_NUMBER+i];
+                seconds[i] -= threadSeconds_[j*CBC_PROFILE_NUMBER+i];
+            }
+        }
+        json += ",\"threads\":[";
+        appendSections(json, calls, seconds);
+        for (int j = 0; j < numberThreads; j++) {
+            json += ',';
+            appendSections(json, &threadCalls_[j*CBC_PROFILE_NUMBER],
+                           &threadSeconds_[j*CBC_PROFILE_NUMBER]);
+        }
+        json += ']';
+    }
+    json += ",\"cutGenerators\":[";
+    for (int i = 0; i < model->numberCutGenerators(); i++) {
+        const CbcCutGenerator * generator = model->cutGenerator(i);
+        if (i)
+            json += ',';
+        json += "{\"name\":";
+        appendString(json, generator->cutGeneratorName());
+        json += ',';
+        appendNumber(json, "calls", generator->numberTimesEntered());
+        appendNumber(json, "cuts", generator->numberCutsInTotal());
+        appendNumber(json, "seconds", generator->timeInCutGenerator(), false);
+        json += '}';
+    }
+    json += "],\"heuristics\":[";
+    for (int i = 0; i < model->numberHeuristics(); i++) {
+        const CbcHeuristic * heuristic = model->heuristic(i);
+        if (i)
+            json += ',';
+        json += "{\"name\":";
+        appendString(json, heuristic->heuristicName());
+        json += ',';
+        appendNumber(json, "runs", heuristic->numRuns());
+        appendNumber(json, "solutions", heuristic->numberSolutionsFound(), false);
+        json += '}';
+    }
+    json += "]}";
+    report_ = json;
+}
@@ -0,0 +1,145 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CbcProfile_H
+#define CbcProfile_H
+
+#include <string>
+#include <vector>
+#include "CoinTime.hpp"
+
+class CbcModel;
+
+/** Where branch and bound spends its time.
+
+    Each part of the search being timed has calls and wall clock seconds.
+    Times are inclusive - a resolve inside the cut loop inside a node
+    counts in all three - so they do not add up to the total.
+
+    Each model (so each thread) has its own profile so nothing is shared
+    while searching.  At the end thread profiles are added into the main
+    one, which also keeps each thread's numbers for the report.
+
+    Switched on by CbcModel::setProfiling.  When off there are no timers
+    at all, when on a timer is two calls to CoinGetTimeOfDay.
+*/
+
+/// Parts of search being timed
+enum CbcProfileSection {
+    /// CbcModel::doOneNode
+    CBC_PROFILE_NODE = 0,
+    /// CbcNode::chooseBranch and chooseDynamicBranch (including strong branching)
+    CBC_PROFILE_BRANCH,
+    /// CbcModel::solveWithCuts
+    CBC_PROFILE_CUT_LOOP,
+    /// CbcModel::resolve (all LP resolves)
+    CBC_PROFILE_RESOLVE,
+    /// CbcModel::addCuts (restoring node subproblem)
+    CBC_PROFILE_ADD_CUTS,
+    /// Heuristic calls
+    CBC_PROFILE_HEURISTIC,
+    /// Bound propagation and conflicts after branching
+    CBC_PROFILE_PROPAGATION,
+    /// Choosing node from tree and cleaning tree
+    CBC_PROFILE_TREE,
+    /// Number of sections
+    CBC_PROFILE_NUMBER
+};
+
+class CbcProfile {
+
+public:
+
+    // Default Constructor
+    CbcProfile ();
+
+    // Copy constructor
+    CbcProfile ( const CbcProfile &);
+
+    // Assignment operator
+    CbcProfile & operator=( const CbcProfile& rhs);
+
+    // Destructor
+    ~CbcProfile ();
+
+    /// Zero everything
+    void reset();
+    /// Add a call
+    inline void add(int section, double seconds) {
+        calls_[section]++;
+        seconds_[section] += seconds;
+    }
+    /// Number of calls
+    inline double numberCalls(int section) const {
+        return calls_[section];
+    }
+    /// Seconds
+    inline double seconds(int section) const {
+        return seconds_[section];
+    }
+    /// Name of section (as in report)
+    static const char * sectionName(int section);
+    /// Section from name (-1 if not known)
+    static int section(const char * name);
+    /// Add in profile of a thread (and keep it)
+    void addThread(const CbcProfile & rhs);
+    /// Number of threads added in
+    inline int numberThreads() const {
+        return static_cast<int> (threadCalls_.size()) / CBC_PROFILE_NUMBER;
+    }
+    /** Make report as JSON (totals, per thread, cut generators and
+        search counts from model) */
+    void makeReport(const CbcModel * model);
+    /// Last report ("" if none)
+    inline const char * report() const {
+        return report_.c_str();
+    }
+
+private:
+    /// Calls
+    double calls_[CBC_PROFILE_NUMBER];
+    /// Seconds
+    double seconds_[CBC_PROFILE_NUMBER];
+    /// Calls for each thread added in
+    std::vector<double> threadCalls_;
+    /// Seconds for each thread added in
+    std::vector<double> threadSeconds_;
+    /// Report
+    std::string report_;
+};
+
+/** Times a section from construction until stop() or destruction.
+    Does nothing if profile is NULL */
+class CbcProfileTimer {
+
+public:
+    inline CbcProfileTimer (CbcProfile * profile, int section)
+            : profile_(profile),
+            section_(section),
+            start_(profile ? CoinGetTimeOfDay() : 0.0) {}
+    inline ~CbcProfileTimer () {
+        stop();
+    }
+    /// Stop timing (only first call counts)
+    inline void stop() {
+        if (profile_) {
+            profile_->add(section_, CoinGetTimeOfDay() - start_);
+            profile_ = NULL;
+        }
+    }
+
+private:
+    /// Illegal
+    CbcProfileTimer (const CbcProfileTimer &);
+    CbcProfileTimer & operator=(const CbcProfileTimer &);
+    /// Profile (NULL when stopped)
+    CbcProfile * profile_;
+    /// Section
+    int section_;
+    /// Start time
+    double start_;
+};
+
+#endif
@@ -0,0 +1,719 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#endif
+
+#include "CbcConfig.h"
+
+#include <cassert>
+#include <cmath>
+#include <cfloat>
+
+#include "CoinHelperFunctions.hpp"
+#include "CoinPackedMatrix.hpp"
+#include "CoinTime.hpp"
+#include "CoinFinite.hpp"
+#include "OsiSolverInterface.hpp"
+#include "CbcPropagation.hpp"
+
+// Bounds at or beyond this are treated as infinite
+#define CBC_PROPAGATION_INFINITY 1.0e20
+// Do not trust implied bounds larger than this
+#define CBC_PROPAGATION_LARGE 1.0e12
+
+// Default Constructor
+CbcPropagation::CbcPropagation ()
+        : numberRows_(0),
+        numberColumns_(0),
+        rowStart_(NULL),
+        column_(NULL),
+        rowElement_(NULL),
+        columnStart_(NULL),
+        row_(NULL),
+        columnElement_(NULL),
+        rowLower_(NULL),
+        rowUpper_(NULL),
+        integerType_(NULL),
+        rootLower_(NULL),
+        rootUpper_(NULL),
+        lowerReason_(NULL),
+        upperReason_(NULL),
+        lower_(NULL),
+        upper_(NULL),
+        minActivity_(NULL),
+        maxActivity_(NULL),
+        minInfinite_(NULL),
+        maxInfinite_(NULL),
+        rowStamp_(NULL),
+        queue_(NULL),
+        inQueue_(NULL),
+        changed_(NULL),
+        isChanged_(NULL),
+        stamp_(0),
+        queueStart_(0),
+        queueEnd_(0),
+        numberInQueue_(0),
+        numberChanged_(0),
+        infeasibleRow_(-1),
+        infeasibleSide_(0),
+        infeasibleColumn_(-1),
+        numberCalls_(0),
+        numberInfeasible_(0),
+        numberTightened_(0.0),
+        timeInPropagation_(0.0)
+{
+}
+
+// Copy constructor
+CbcPropagation::CbcPropagation ( const CbcPropagation & rhs)
+        : numberRows_(0),
+        numberColumns_(0),
+        rowStart_(NULL),
+        column_(NULL),
+        rowElement_(NULL),
+        columnStart_(NULL),
+        row_(NULL),
+        columnElement_(NULL),
+        rowLower_(NULL),
+        rowUpper_(NULL),
+        integerType_(NULL),
+        rootLower_(NULL),
+        rootUpper_(NULL),
+        lowerReason_(NULL),
+        upperReason_(NULL),
+        lower_(NULL),
+        upper_(NULL),
+        minActivity_(NULL),
+        maxActivity_(NULL),
+        minInfinite_(NULL),
+        maxInfinite_(NULL),
+        rowStamp_(NULL),
+        queue_(NULL),
+        inQueue_(NULL),
+        changed_(NULL),
+        isChanged_(NULL),
+        stamp_(0),
+        queueStart_(0),
+        queueEnd_(0),
+        numberInQueue_(0),
+        numberChanged_(0),
+        infeasibleRow_(-1),
+        infeasibleSide_(0),
+        infeasibleColumn_(-1),
+        numberCalls_(0),
+        numberInfeasible_(0),
+        numberTightened_(0.0),
+        timeInPropagation_(0.0)
+{
+    gutsOfCopy(rhs);
+}
+
+// Assignment operator
+CbcPropagation &
+CbcPropagation::operator=( const CbcPropagation & rhs)
+{
+    if (this != &rhs) {
+        gutsOfDelete();
+        gutsOfCopy(rhs);
+    }
+    return *this;
+}
+
+// Destructor
+CbcPropagation::~CbcPropagation ()
+{
+    gutsOfDelete();
+}
+
+// Free all arrays
+void
+CbcPropagation::gutsOfDelete()
+{
+    delete [] rowStart_;
+    delete [] column_;
+    delete [] rowElement_;
+    delete [] columnStart_;
+    delete [] row_;
+    delete [] columnElement_;
+    delete [] rowLower_;
+    delete [] rowUpper_;
+    delete [] integerType_;
+    delete [] rootLower_;
+    delete [] rootUpper_;
+    delete [] lowerReason_;
+    delete [] upperReason_;
+    delete [] lower_;
+    delete [] upper_;
+    delete [] minActivity_;
+    delete [] maxActivity_;
+    delete [] minInfinite_;
+    delete [] maxInfinite_;
+    delete [] rowStamp_;
+    delete [] queue_;
+    delete [] inQueue_;
+    delete [] changed_;
+    delete [] isChanged_;
+    rowStart_ = NULL;
+    column_ = NULL;
+    rowElement_ = NULL;
+    columnStart_ = NULL;
+    row_ = NULL;
+    columnElement_ = NULL;
+    rowLower_ = NULL;
+    rowUpper_ = NULL;
+    integerType_ = NULL;
+    rootLower_ = NULL;
+    rootUpper_ = NULL;
+    lowerReason_ = NULL;
+    upperReason_ = NULL;
+    lower_ = NULL;
+    upper_ = NULL;
+    minActivity_ = NULL;
+    maxActivity_ = NULL;
+    minInfinite_ = NULL;
+    maxInfinite_ = NULL;
+    rowStamp_ = NULL;
+    queue_ = NULL;
+    inQueue_ = NULL;
+    changed_ = NULL;
+    isChanged_ = NULL;
+    numberRows_ = 0;
+    numberColumns_ = 0;
+    stamp_ = 0;
+    infeasibleRow_ = -1;
+    infeasibleColumn_ = -1;
+}
+
+// Copy all arrays (work arrays are just allocated)
+void
+CbcPropagation::gutsOfCopy(const CbcPropagation & rhs)
+{
+    numberCalls_ = rhs.numberCalls_;
+    numberInfeasible_ = rhs.numberInfeasible_;
+    numberTightened_ = rhs.numberTightened_;
+    timeInPropagation_ = rhs.timeInPropagation_;
+    numberRows_ = rhs.numberRows_;
+    numberColumns_ = rhs.numberColumns_;
+    if (numberRows_) {
+        CoinBigIndex numberElements = rhs.rowStart_[numberRows_];
+        CoinBigIndex numberWatched = rhs.columnStart_[numberColumns_];
+        rowStart_ = CoinCopyOfArray(rhs.rowStart_, numberRows_ + 1);
+        column_ = CoinCopyOfArray(rhs.column_, numberElements);
+        rowElement_ = CoinCopyOfArray(rhs.rowElement_, numberElements);
+        columnStart_ = CoinCopyOfArray(rhs.columnStart_, numberColumns_ + 1);
+        row_ = CoinCopyOfArray(rhs.row_, numberWatched);
+        columnElement_ = CoinCopyOfArray(rhs.columnElement_, numberWatched);
+        rowLower_ = CoinCopyOfArray(rhs.rowLower_, numberRows_);
+        rowUpper_ = CoinCopyOfArray(rhs.rowUpper_, numberRows_);
+        integerType_ = CoinCopyOfArray(rhs.integerType_, numberColumns_);
+        rootLower_ = CoinCopyOfArray(rhs.rootLower_, numberColumns_);
+        rootUpper_ = CoinCopyOfArray(rhs.rootUpper_, numberColumns_);
+        lowerReason_ = new int [numberColumns_];
+        upperReason_ = new int [numberColumns_];
+        lower_ = new double [numberColumns_];
+        upper_ = new double [numberColumns_];
+        minActivity_ = new double [numberRows_];
+        maxActivity_ = new double [numberRows_];
+        minInfinite_ = new int [numberRows_];
+        maxInfinite_ = new int [numberRows_];
+        rowStamp_ = new int [numberRows_];
+        CoinZeroN(rowStamp_, numberRows_);
+        queue_ = new int [numberRows_];
+        inQueue_ = new char [numberRows_];
+        CoinZeroN(inQueue_, numberRows_);
+        changed_ = new int [numberColumns_];
+        isChanged_ = new char [numberColumns_];
+        CoinZeroN(isChanged_, numberColumns_);
+    }
+}
+
+// Set up from solver
+void
+CbcPropagation::initialize(const OsiSolverInterface * solver, int maximumLength)
+{
+    gutsOfDelete();
+    int numberRows = solver->getNumRows();
+    int numberColumns = solver->getNumCols();
+    if (!numberRows || !numberColumns)
+        return;
+    const CoinPackedMatrix * rowCopy = solver->getMatrixByRow();
+    const double * element = rowCopy->getElements();
+    const int * column = rowCopy->getIndices();
+    const CoinBigIndex * rowStart = rowCopy->getVectorStarts();
+    const int * rowLength = rowCopy->getVectorLengths();
+    const double * rowLower = solver->getRowLower();
+    const double * rowUpper = solver->getRowUpper();
+    numberRows_ = numberRows;
+    numberColumns_ = numberColumns;
+    CoinBigIndex numberElements = 0;
+    for (int iRow = 0; iRow < numberRows; iRow++)
+        numberElements += rowLength[iRow];
+    rowStart_ = new CoinBigIndex [numberRows + 1];
+    column_ = new int [numberElements];
+    rowElement_ = new double [numberElements];
+    rowLower_ = CoinCopyOfArray(rowLower, numberRows);
+    rowUpper_ = CoinCopyOfArray(rowUpper, numberRows);
+    // pack row copy and count watched rows for each column
+    columnStart_ = new CoinBigIndex [numberColumns + 1];
+    CoinZeroN(columnStart_, numberColumns + 1);
+    char * watch = new char [numberRows];
+    numberElements = 0;
+    rowStart_[0] = 0;
+    for (int iRow = 0; iRow < numberRows; iRow++) {
+        watch[iRow] = (rowLength[iRow] <= maximumLength &&
+                       (rowLower[iRow] > -CBC_PROPAGATION_INFINITY ||
+                        rowUpper[iRow] < CBC_PROPAGATION_INFINITY)) ? 1 : 0;
+        for (CoinBigIndex j = rowStart[iRow]; j < rowStart[iRow] + rowLength[iRow]; j++) {
+            if (element[j]) {
+                int iColumn = column[j];
+                column_[numberElements] = iColumn;
+                rowElement_[numberElements++] = element[j];
+                if (watch[iRow])
+                    columnStart_[iColumn+1]++;
+            }
+        }
+        rowStart_[iRow+1] = numberElements;
+    }
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+        columnStart_[iColumn+1] += columnStart_[iColumn];
+    CoinBigIndex numberWatched = columnStart_[numberColumns];
+    row_ = new int [numberWatched];
+    columnElement_ = new double [numberWatched];
+    CoinBigIndex * put = CoinCopyOfArray(columnStart_, numberColumns);
+    for (int iRow = 0; iRow < numberRows; iRow++) {
+        if (!watch[iRow])
+            continue;
+        for (CoinBigIndex j = rowStart_[iRow]; j < rowStart_[iRow+1]; j++) {
+            int iColumn = column_[j];
+            CoinBigIndex k = put[iColumn]++;
+            row_[k] = iRow;
+            columnElement_[k] = rowElement_[j];
+        }
+    }
+    delete [] put;
+    delete [] watch;
+    integerType_ = new char [numberColumns];
+    for (int iColumn = 0; iColumn < numberColumns; iColumn++)
+        integerType_[iColumn] = solver->isInteger(iColumn) ? 1 : 0;
+    rootLower_ = CoinCopyOfArray(solver->getColLower(), numberColumns);
+    rootUpper_ = CoinCopyOfArray(solver->getColUpper(), numberColumns);
+    lowerReason_ = new int [numberColumns];
+    upperReason_ = new int [numberColumns];
+    lower_ = new double [numberColumns];
+    upper_ = new double [numberColumns];
+    minActivity_ = new double [numberRows];
+    maxActivity_ = new double [numberRows];
+    minInfinite_ = new int [numberRows];
+    maxInfinite_ = new int [numberRows];
+    rowStamp_ = new int [numberRows];
+    CoinZeroN(rowStamp_, numberRows);
+    queue_ = new int [numberRows];
+    inQueue_ = new char [numberRows];
+    CoinZeroN(inQueue_, numberRows);
+    changed_ = new int [numberColumns];
+    isChanged_ = new char [numberColumns];
+    CoinZeroN(isChanged_, numberColumns);
+}
+
+// Compute activities of row from scratch
+void
+CbcPropagation::computeActivity(int iRow)
+{
+    double minActivity = 0.0;
+    double maxActivity = 0.0;
+    int minInfinite = 0;
+    int maxInfinite = 0;
+    for (CoinBigIndex j = rowStart_[iRow]; j < rowStart_[iRow+1]; j++) {
+        int iColumn = column_[j];
+        double value = rowElement_[j];
+        double lower = lower_[iColumn];
+        double upper = upper_[iColumn];
+        if (value > 0.0) {
+            if (lower > -CBC_PROPAGATION_INFINITY)
+                minActivity += value * lower;
+            else
+                minInfinite++;
+            if (upper < CBC_PROPAGATION_INFINITY)
+                maxActivity += value * upper;
+            else
+                maxInfinite++;
+        } else {
+            if (upper < CBC_PROPAGATION_INFINITY)
+                minActivity += value * upper;
+            else
+                minInfinite++;
+            if (lower > -CBC_PROPAGATION_INFINITY)
+                maxActivity += value * lower;
+            else
+                maxInfinite++;
+        }
+    }
+    minActivity_[iRow] = minActivity;
+    maxActivity_[iRow] = maxActivity;
+    minInfinite_[iRow] = minInfinite;
+    maxInfinite_[iRow] = maxInfinite;
+    rowStamp_[iRow] = stamp_;
+}
+
+// Change bound on column and update computed activities
+void
+CbcPropagation::changeBound(int iColumn, double newValue, bool isLower, int reason)
+{
+    double oldValue;
+    if (isLower) {
+        oldValue = lower_[iColumn];
+        lower_[iColumn] = newValue;
+        lowerReason_[iColumn] = reason;
+    } else {
+        oldValue = upper_[iColumn];
+        upper_[iColumn] = newValue;
+        upperReason_[iColumn] = reason;
+    }
+    if (!isChanged_[iColumn]) {
+        isChanged_[iColumn] = 1;
+        changed_[numberChanged_++] = iColumn;
+    }
+    bool wasInfinite = fabs(oldValue) >= CBC_PROPAGATION_INFINITY;
+    for (CoinBigIndex j = columnStart_[iColumn]; j < columnStart_[iColumn+1]; j++) {
+        int iRow = row_[j];
+        if (rowStamp_[iRow] == stamp_) {
+            double value = columnElement_[j];
+            // lower bound gives minimum activity if element positive
+            if ((value > 0.0) == isLower) {
+                if (wasInfinite) {
+                    minInfinite_[iRow]--;
+                    minActivity_[iRow] += value * newValue;
+                } else {
+                    minActivity_[iRow] += value * (newValue - oldValue);
+                }
+            } else {
+                if (wasInfinite) {
+                    maxInfinite_[iRow]--;
+                    maxActivity_[iRow] += value * newValue;
+                } else {
+                    maxActivity_[iRow] += value * (newValue - oldValue);
+                }
+            }
+        }
+        addToQueue(iRow);
+    }
+}
+
+/* Propagate changes between lowerBefore/upperBefore and bounds in solver.
+   Returns number of bounds tightened or -1 if infeasible */
+int
+CbcPropagation::propagate(OsiSolverInterface * solver,
+                          const double * lowerBefore, const double * upperBefore)
+{
+    if (!numberRows_)
+        return 0;
+    assert (solver->getNumCols() == numberColumns_);
+    assert (solver->getNumRows() >= numberRows_);
+    double time1 = CoinCpuTime();
+    numberCalls_++;
+    if (stamp_ == COIN_INT_MAX) {
+        CoinZeroN(rowStamp_, numberRows_);
+        stamp_ = 0;
+    }
+    stamp_++;
+    const double * lower = solver->getColLower();
+    const double * upper = solver->getColUpper();
+    CoinMemcpyN(lower, numberColumns_, lower_);
+    CoinMemcpyN(upper, numberColumns_, upper_);
+    queueStart_ = 0;
+    queueEnd_ = 0;
+    numberInQueue_ = 0;
+    numberChanged_ = 0;
+    infeasibleRow_ = -1;
+    infeasibleColumn_ = -1;
+    // rows watched by columns changed by branch
+    for (int iColumn = 0; iColumn < numberColumns_; iColumn++) {
+        lowerReason_[iColumn] = -1;
+        upperReason_[iColumn] = -1;
+        if (lower[iColumn] != lowerBefore[iColumn] ||
+                upper[iColumn] != upperBefore[iColumn]) {
+            for (CoinBigIndex j = columnStart_[iColumn]; j < columnStart_[iColumn+1]; j++)
+                addToQueue(row_[j]);
+        }
+    }
+    int numberTightened = 0;
+    bool feasible = true;
+    // limit work
+    int numberLeft = 2 * numberRows_ + 100;
+    while (numberInQueue_ && numberLeft && feasible) {
+        numberLeft--;
+        int iRow = queue_[queueStart_];
+        queueStart_ = (queueStart_ + 1) % numberRows_;
+        numberInQueue_--;
+        inQueue_[iRow] = 0;
+        if (rowStamp_[iRow] != stamp_)
+            computeActivity(iRow);
+        double rowLower = rowLower_[iRow];
+        double rowUpper = rowUpper_[iRow];
+        if (!minInfinite_[iRow] &&
+                minActivity_[iRow] > rowUpper + 1.0e-6 * (1.0 + fabs(rowUpper))) {
+            feasible = false;
+            infeasibleRow_ = iRow;
+            infeasibleSide_ = 0;
+            break;
+        }
+        if (!maxInfinite_[iRow] &&
+                maxActivity_[iRow] < rowLower - 1.0e-6 * (1.0 + fabs(rowLower))) {
+            feasible = false;
+            infeasibleRow_ = iRow;
+            infeasibleSide_ = 1;
+            break;
+        }
+        for (CoinBigIndex j = rowStart_[iRow]; j < rowStart_[iRow+1]; j++) {
+            int iColumn = column_[j];
+            if (!integerType_[iColumn])
+                continue;
+            double columnLower = lower_[iColumn];
+            double columnUpper = upper_[iColumn];
+            if (columnLower == columnUpper)
+                continue;
+            double value = rowElement_[j];
+            // activities without this column
+            double minBound = (value > 0.0) ? columnLower : columnUpper;
+            double maxBound = (value > 0.0) ? columnUpper : columnLower;
+            bool minOK;
+            double minResidual;
+            if (fabs(minBound) < CBC_PROPAGATION_INFINITY) {
+                minOK = !minInfinite_[iRow];
+                minResidual = minActivity_[iRow] - value * minBound;
+            } else {
+                minOK = minInfinite_[iRow] == 1;
+                minResidual = minActivity_[iRow];
+            }
+            bool maxOK;
+            double maxResidual;
+            if (fabs(maxBound) < CBC_PROPAGATION_INFINITY) {
+                maxOK = !maxInfinite_[iRow];
+                maxResidual = maxActivity_[iRow] - value * maxBound;
+            } else {
+                maxOK = maxInfinite_[iRow] == 1;
+                maxResidual = maxActivity_[iRow];
+            }
+            double newLower = columnLower;
+            double newUpper = columnUpper;
+            // which side of row gave bound
+            int lowerSide = -1;
+            int upperSide = -1;
+            if (minOK && rowUpper < CBC_PROPAGATION_INFINITY) {
+                // value * x <= rowUpper - minResidual
+                double bound = (rowUpper - minResidual) / value;
+                if (fabs(bound) < CBC_PROPAGATION_LARGE) {
+                    if (value > 0.0) {
+                        bound = floor(bound + 1.0e-6);
+                        if (bound < newUpper) {
+                            newUpper = bound;
+                            upperSide = 0;
+                        }
+                    } else {
+                        bound = ceil(bound - 1.0e-6);
+                        if (bound > newLower) {
+                            newLower = bound;
+                            lowerSide = 0;
+                        }
+                    }
+                }
+            }
+            if (maxOK && rowLower > -CBC_PROPAGATION_INFINITY) {
+                // value * x >= rowLower - maxResidual
+                double bound = (rowLower - maxResidual) / value;
+                if (fabs(bound) < CBC_PROPAGATION_LARGE) {
+                    if (value > 0.0) {
+                        bound = ceil(bound - 1.0e-6);
+                        if (bound > newLower) {
+                            newLower = bound;
+                            lowerSide = 1;
+                        }
+                    } else {
+                        bound = floor(bound + 1.0e-6);
+                        if (bound < newUpper) {
+                            newUpper = bound;
+                            upperSide = 1;
+                        }
+                    }
+                }
+            }
+            if (newLower > newUpper) {
+                feasible = false;
+                infeasibleRow_ = iRow;
+                infeasibleSide_ = 2;
+                infeasibleColumn_ = iColumn;
+                break;
+            }
+            if (lowerSide >= 0) {
+                changeBound(iColumn, newLower, true, 2 * iRow + lowerSide);
+                numberTightened++;
+            }
+            if (upperSide >= 0) {
+                changeBound(iColumn, newUpper, false, 2 * iRow + upperSide);
+                numberTightened++;
+            }
+        }
+    }
+    // clean up work arrays
+    while (numberInQueue_) {
+        inQueue_[queue_[queueStart_]] = 0;
+        queueStart_ = (queueStart_ + 1) % numberRows_;
+        numberInQueue_--;
+    }
+    for (int i = 0; i < numberChanged_; i++) {
+        int iColumn = changed_[i];
+        isChanged_[iColumn] = 0;
+        if (feasible) {
+            if (lower_[iColumn] > lower[iColumn])
+                solver->setColLower(iColumn, lower_[iColumn]);
+            if (upper_[iColumn] < upper[iColumn])
+                solver->setColUpper(iColumn, upper_[iColumn]);
+        }
+    }
+    numberChanged_ = 0;
+    timeInPropagation_ += CoinCpuTime() - time1;
+    if (!feasible) {
+        numberInfeasible_++;
+        return -1;
+    } else {
+        numberTightened_ += numberTightened;
+        return numberTightened;
+    }
+}
+
+// Add one literal if not there - returns false if too many
+bool
+CbcPropagation::addLiteral(int iColumn, double value, char upper, int & number,
+                           int * column, double * bound, char * isUpper,
+                           int maximumLength)
+{
+    for (int i = 0; i < number; i++) {
+        if (column[i] == iColumn && isUpper[i] == upper) {
+            // keep tighter (the one needed)
+            if (upper)
+                bound[i] = CoinMin(bound[i], value);
+            else
+                bound[i] = CoinMax(bound[i], value);
+            return true;
+        }
+    }
+    if (number == maximumLength)
+        return false;
+    column[number] = iColumn;
+    bound[number] = value;
+    isUpper[number++] = upper;
+    return true;
+}
+
+// Add literals making side of row imply what it did
+bool
+CbcPropagation::rowLiterals(int iRow, int side, int exclude, int & number,
+                            int * column, double * bound, char * isUpper,
+                            int maximumLength) const
+{
+    for (CoinBigIndex j = rowStart_[iRow]; j < rowStart_[iRow+1]; j++) {
+        int iColumn = column_[j];
+        if (iColumn == exclude)
+            continue;
+        // minimum activity uses lower bound if element positive
+        bool useLower = (rowElement_[j] > 0.0) == (side == 0);
+        if (useLower) {
+            if (lower_[iColumn] > rootLower_[iColumn] &&
+                    !addLiteral(iColumn, lower_[iColumn], 0, number,
+                                column, bound, isUpper, maximumLength))
+                return false;
+        } else {
+            if (upper_[iColumn] < rootUpper_[iColumn] &&
+                    !addLiteral(iColumn, upper_[iColumn], 1, number,
+                                column, bound, isUpper, maximumLength))
+                return false;
+        }
+    }
+    return true;
+}
+
+/* Get conflict after infeasibility.
+   Literals use bounds when infeasibility was found, which are at least as
+   tight as those used for any implication, so the set is valid.  An
+   implied literal is replaced by the literals of its reason only if none of
+   those were themselves implied in this call (then their values have not
+   changed since the implication was made).
+*/
+int
+CbcPropagation::conflict(int * column, double * bound, char * isUpper,
+                         int maximumLength) const
+{
+    if (infeasibleRow_ < 0)
+        return -1;
+    int number = 0;
+    int iRow = infeasibleRow_;
+    if (infeasibleSide_ != 1 &&
+            !rowLiterals(iRow, 0, infeasibleColumn_, number, column, bound,
+                         isUpper, maximumLength))
+        return -1;
+    if (infeasibleSide_ != 0 &&
+            !rowLiterals(iRow, 1, infeasibleColumn_, number, column, bound,
+                         isUpper, maximumLength))
+        return -1;
+    if (infeasibleColumn_ >= 0) {
+        int iColumn = infeasibleColumn_;
+        if (lower_[iColumn] > rootLower_[iColumn] &&
+                !addLiteral(iColumn, lower_[iColumn], 0, number,
+                            column, bound, isUpper, maximumLength))
+            return -1;
+        if (upper_[iColumn] < rootUpper_[iColumn] &&
+                !addLiteral(iColumn, upper_[iColumn], 1, number,
+                            column, bound, isUpper, maximumLength))
+            return -1;
+    }
+    // one level of resolution
+    int * tempColumn = new int [maximumLength];
+    double * tempBound = new double [maximumLength];
+    char * tempUpper = new char [maximumLength];
+    for (int i = 0; i < number; i++) {
+        int iColumn = column[i];
+        int reason = isUpper[i] ? upperReason_[iColumn] : lowerReason_[iColumn];
+        if (reason < 0)
+            continue;
+        int reasonRow = reason >> 1;
+        int side = reason & 1;
+        int numberTemp = 0;
+        bool exact = rowLiterals(reasonRow, side, iColumn, numberTemp, tempColumn,
+                                 tempBound, tempUpper, maximumLength);
+        for (int k = 0; k < numberTemp && exact; k++) {
+            int jColumn = tempColumn[k];
+            if ((tempUpper[k] ? upperReason_[jColumn] : lowerReason_[jColumn]) >= 0)
+                exact = false;
+        }
+        if (!exact || number - 1 + numberTemp > maximumLength)
+            continue;
+        // replace literal i
+        number--;
+        column[i] = column[number];
+        bound[i] = bound[number];
+        isUpper[i] = isUpper[number];
+        for (int k = 0; k < numberTemp; k++)
+            addLiteral(tempColumn[k], tempBound[k], tempUpper[k], number,
+                       column, bound, isUpper, maximumLength);
+        i--;
+    }
+    delete [] tempColumn;
+    delete [] tempBound;
+    delete [] tempUpper;
+    return number;
+}
+
+// Add in statistics from another copy
+void
+CbcPropagation::addStatistics(const CbcPropagation & rhs)
+{
+    numberCalls_ += rhs.numberCalls_;
+    numberInfeasible_ += rhs.numberInfeasible_;
+    numberTightened_ += rhs.numberTightened_;
+    timeInPropagation_ += rhs.timeInPropagation_;
+}
@@ -0,0 +1,200 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#ifndef CbcPropagation_H
+#define CbcPropagation_H
+
+#include "CoinPragma.hpp"
+#include "CoinTypes.hpp"
+
+class OsiSolverInterface;
+
+/** Activity based bound propagation at nodes.
+
+    Keeps a row copy of the original constraints and, for each column, the
+    rows it appears in (watched rows).  After a branch only rows watched by
+    columns whose bounds changed are looked at.  Minimum and maximum row
+    activities are computed the first time a row is seen in a call and
+    then updated incrementally as bounds are tightened, so a chain of
+    implications costs little more than the rows it touches.
+
+    Only bounds on integer variables are tightened (continuous ones are
+    left to the LP) and very long rows are not watched.
+
+    The row and side implying each bound in a call are remembered so
+    that after infeasibility a short conflict (set of bounds which can not
+    all hold) can be extracted - see conflict().
+*/
+
+class CbcPropagation {
+
+public:
+
+    // Default Constructor
+    CbcPropagation ();
+
+    // Copy constructor
+    CbcPropagation ( const CbcPropagation &);
+
+    // Assignment operator
+    CbcPropagation & operator=( const CbcPropagation& rhs);
+
+    // Destructor
+    ~CbcPropagation ();
+
+    /** Set up from solver - normally continuous solver.
+        Rows longer than maximumLength are not watched */
+    void initialize(const OsiSolverInterface * solver, int maximumLength = 1000);
+
+    /** Propagate changes between lowerBefore/upperBefore and bounds in
+        solver.  Only first numberRows() rows of solver are used (cuts
+        are ignored).  Tightened bounds are set in solver.
+        Returns number of bounds tightened or -1 if node is infeasible.
+    */
+    int propagate(OsiSolverInterface * solver,
+                  const double * lowerBefore, const double * upperBefore);
+
+    /** After propagate returned -1, get a conflict - bounds which can
+        not all hold.  Literal i is column[i] <= bound[i] if isUpper[i]
+        nonzero, otherwise column[i] >= bound[i].  Bounds equal to those
+        at initialize are left out.  Implied bounds are replaced by their
+        reasons where that is exact.
+        Returns number of literals or -1 if none or more than maximumLength.
+    */
+    int conflict(int * column, double * bound, char * isUpper,
+                 int maximumLength) const;
+
+    /// Add in statistics from another copy (e.g. a thread)
+    void addStatistics(const CbcPropagation & rhs);
+
+    /// Number of rows (0 if not initialized)
+    inline int numberRows() const {
+        return numberRows_;
+    }
+    /// Number of times propagate called
+    inline int numberCalls() const {
+        return numberCalls_;
+    }
+    /// Number of bounds tightened
+    inline double numberTightened() const {
+        return numberTightened_;
+    }
+    /// Number of times infeasibility found (LPs avoided)
+    inline int numberInfeasible() const {
+        return numberInfeasible_;
+    }
+    /// Time spent in propagate
+    inline double timeInPropagation() const {
+        return timeInPropagation_;
+    }
+
+private:
+    /// Free all arrays
+    void gutsOfDelete();
+    /// Copy all arrays
+    void gutsOfCopy(const CbcPropagation & rhs);
+    /// Compute activities of row from scratch
+    void computeActivity(int iRow);
+    /** Change bound on column and update computed activities.
+        Rows affected are queued.  reason is 2*row+side */
+    void changeBound(int iColumn, double newValue, bool isLower, int reason);
+    /** Add literals making side of row (0 minimum activity, 1 maximum)
+        imply what it did.  Returns false if too many */
+    bool rowLiterals(int iRow, int side, int exclude, int & number,
+                     int * column, double * bound, char * isUpper,
+                     int maximumLength) const;
+    /// Add one literal if not there - returns false if too many
+    static bool addLiteral(int iColumn, double value, char upper, int & number,
+                           int * column, double * bound, char * isUpper,
+                           int maximumLength);
+    /// Add row to queue if not there
+    inline void addToQueue(int iRow) {
+        if (!inQueue_[iRow]) {
+            inQueue_[iRow] = 1;
+            queue_[queueEnd_] = iRow;
+            queueEnd_ = (queueEnd_ + 1) % numberRows_;
+            numberInQueue_++;
+        }
+    }
+
+    /// Number of rows
+    int numberRows_;
+    /// Number of columns
+    int numberColumns_;
+    /// Row starts of row copy
+    CoinBigIndex * rowStart_;
+    /// Columns in row copy
+    int * column_;
+    /// Elements in row copy
+    double * rowElement_;
+    /// Column starts of watched rows
+    CoinBigIndex * columnStart_;
+    /// Watched rows for each column
+    int * row_;
+    /// Elements for watched rows
+    double * columnElement_;
+    /// Row lower bounds
+    double * rowLower_;
+    /// Row upper bounds
+    double * rowUpper_;
+    /// Nonzero if integer
+    char * integerType_;
+    /// Column lower bounds at initialize
+    double * rootLower_;
+    /// Column upper bounds at initialize
+    double * rootUpper_;
+    /// Reason (2*row+side) for lower bound in this call or -1 (work)
+    int * lowerReason_;
+    /// Reason (2*row+side) for upper bound in this call or -1 (work)
+    int * upperReason_;
+    /// Current column lower bounds (work)
+    double * lower_;
+    /// Current column upper bounds (work)
+    double * upper_;
+    /// Minimum activity - finite part (work)
+    double * minActivity_;
+    /// Maximum activity - finite part (work)
+    double * maxActivity_;
+    /// Number of infinite contributions to minimum activity (work)
+    int * minInfinite_;
+    /// Number of infinite contributions to maximum activity (work)
+    int * maxInfinite_;
+    /// Call stamp when row activity computed (work)
+    int * rowStamp_;
+    /// Circular queue of rows (work)
+    int * queue_;
+    /// Nonzero if row in queue (work)
+    char * inQueue_;
+    /// Columns changed (work)
+    int * changed_;
+    /// Nonzero if column in changed_ (work)
+    char * isChanged_;
+    /// Current stamp
+    int stamp_;
+    /// Start of queue
+    int queueStart_;
+    /// End of queue
+    int queueEnd_;
+    /// Number in queue
+    int numberInQueue_;
+    /// Number of columns changed
+    int numberChanged_;
+    /// Row found infeasible in last call or -1
+    int infeasibleRow_;
+    /// Side of row infeasible (0 minimum, 1 maximum, 2 both)
+    int infeasibleSide_;
+    /// Column whose bounds crossed in last call or -1
+    int infeasibleColumn_;
+    /// Number of calls
+    int numberCalls_;
+    /// Number of infeasible nodes found
+    int numberInfeasible_;
+    /// Number of bounds tightened
+    double numberTightened_;
+    /// Time in propagation
+    double timeInPropagation_;
+};
+
+#endif
@@ -53,6 +53,9 @@
 #include "OsiChooseVariable.hpp"
 #include "OsiAuxInfo.hpp"
 #include "CbcMipStartIO.hpp"
+#include "CbcBinaryModel.hpp"
+#include "CbcClpUnitTest.hpp"
+#include "CbcModelCache.hpp"
 // for printing
 #ifndef CLP_OUTPUT_FORMAT
 #define CLP_OUTPUT_FORMAT %15.8g
@@ -182,6 +185,7 @@ static int initialPumpTune = -1;
 #endif
 
 #include "CglPreProcess.hpp"
+#include "CbcPreProcessProbing.hpp"
 #include "CglCutGenerator.hpp"
 #include "CglGomory.hpp"
 #include "CglProbing.hpp"
@@ -1157,10 +1161,8 @@ int callCbc1(const char * input2, CbcModel & model,
 }
 
 CglPreProcess * cbcPreProcessPointer=NULL;
-
-int CbcClpUnitTest (const CbcModel & saveModel,
-                    const std::string& dirMiplib, int testSwitch,
-                    const double * stuff);
+// Cache for modelcache command - kept as model may outlive CbcMain1
+static CbcModelCache solverModelCache;
 
 int CbcMain1 (int argc, const char *argv[],
               CbcModel  & model)
@@ -1938,6 +1940,79 @@ int CbcMain1 (int argc, const char *argv[],
                 }
             }
 
+#ifndef CBC_OTHER_SOLVER
+            if (field == "exportbin" || field == "-exportbin") {
+                // binary model file (parameter table is in Clp so done here)
+                numberGoodCommands++;
+                field = CoinReadGetString(argc, argv);
+                if (field == "EOL" || !field.length()) {
+                    printGeneralMessage(model_, "exportbin needs a file name");
+                    continue;
+                }
+                if (!goodModel) {
+                    printGeneralMessage(model_, "** Current model not valid");
+                    continue;
+                }
+                std::string fileName;
+                if (field[0] == '/' || field[0] == '\\') {
+                    fileName = field;
+                } else if (field[0] == '~') {
+                    char * environVar = getenv("HOME");
+                    if (environVar) {
+                        std::string home(environVar);
+                        field = field.erase(0, 1);
+                        fileName = home + field;
+                    } else {
+                        fileName = field;
+                    }
+                } else {
+                    fileName = directory + field;
+                }
+                if (!writeBinaryModel(clpSolver, fileName.c_str(), keepImportNames != 0))
+                    sprintf(generalPrint, "Binary model written to %s", fileName.c_str());
+                else
+                    sprintf(generalPrint, "Unable to write binary model to %s", fileName.c_str());
+                printGeneralMessage(model_, generalPrint);
+                continue;
+            }
+#endif
+            if (field == "modelcache" || field == "-modelcache") {
+                // basis, pseudo costs and root cuts by model structure
+                // (parameter table is in Clp so done here)
+                numberGoodCommands++;
+                field = CoinReadGetString(argc, argv);
+                if (field == "EOL" || !field.length()) {
+                    printGeneralMessage(model_, "modelcache needs a directory (or off)");
+                    continue;
+                }
+                // a cache from caller (e.g. C interface) is owned by caller
+                CbcModelCache * cache = model_.modelCache();
+                if (field == "off") {
+                    if (cache == &solverModelCache) {
+                        model_.setModelCache(NULL);
+                        printGeneralMessage(model_, "Model cache off");
+                    } else if (cache) {
+                        printGeneralMessage(model_, "Model cache belongs to caller - left on");
+                    }
+                } else {
+                    std::string cacheDirectory;
+                    if (field == "memory")
+                        cacheDirectory = "";
+                    else if (field[0] == '/' || field[0] == '\\')
+                        cacheDirectory = field;
+                    else
+                        cacheDirectory = directory + field;
+                    if (!cache) {
+                        cache = &solverModelCache;
+                        model_.setModelCache(cache);
+                    }
+                    cache->setDirectory(cacheDirectory.c_str());
+                    sprintf(generalPrint, "Model cache in %s",
+                            cacheDirectory.length() ? cacheDirectory.c_str() : "memory");
+                    printGeneralMessage(model_, generalPrint);
+                }
+                continue;
+            }
             // see if ? at end
             size_t numberQuery = 0;
             if (field != "?" && field != "???") {
@@ -4103,8 +4178,24 @@ int CbcMain1 (int argc, const char *argv[],
                                     if ((babModel_->specialOptions()&65536) != 0)
                                         process.setOptions(1);
                                     // Add in generators
-				    if ((model_.moreSpecialOptions()&65536)==0)
-				      process.addCutGenerator(&generator1);
+				    if ((model_.moreSpecialOptions()&65536)==0) {
+				      double maximumSeconds = babModel_->getDblParam(CbcModel::CbcPreProcessSeconds);
+				      int numberThreads = 1;
+#ifdef CBC_THREAD
+				      numberThreads = parameters_[whichParam(CBC_PARAM_INT_THREADS, numberParameters_, parameters_)].intValue() % 100;
+#endif
+				      // plain CglProbing lets CglPreProcess strengthen coefficients
+				      if (CbcPreProcessProbing::wanted(*saveSolver, maximumSeconds,
+								       numberThreads)) {
+					// budgeted and threaded probing
+					CbcPreProcessProbing budgetProbing(generator1, babModel_,
+									   maximumSeconds,
+									   CoinMax(numberThreads, 1));
+					process.addCutGenerator(&budgetProbing);
+				      } else {
+					process.addCutGenerator(&generator1);
+				      }
+				    }
                                     int translate[] = {9999, 0, 0, -3, 2, 3, -2, 9999, 4, 5};
                                     process.passInMessageHandler(babModel_->messageHandler());
                                     //process.messageHandler()->setLogLevel(babModel_->logLevel());
@@ -4383,6 +4474,13 @@ int CbcMain1 (int argc, const char *argv[],
                                     integersOK = false; // We need to redo if CbcObjects exist
                                     // Tell solver we are not in Branch and Cut
                                     saveSolver->setHintParam(OsiDoInBranchAndCut, false, OsiHintDo) ;
+                                    // per pass report (process has its own copy of generator)
+                                    for (int iGenerator = 0; iGenerator < process.numberCutGenerators(); iGenerator++) {
+                                        CbcPreProcessProbing * budgetProbing =
+                                            dynamic_cast<CbcPreProcessProbing *> (process.cutGenerator(iGenerator));
+                                        if (budgetProbing && !noPrinting_)
+                                            budgetProbing->report();
+                                    }
                                     if (solver2)
                                         solver2->setHintParam(OsiDoInBranchAndCut, false, OsiHintDo) ;
                                 }
@@ -5130,6 +5228,16 @@ int CbcMain1 (int argc, const char *argv[],
                             if (!miplib) {
                                 if (parameters_[whichParam(CBC_PARAM_STR_LOCALTREE, numberParameters_, parameters_)].currentOptionAsInteger()) {
                                     CbcTreeLocal localTree(babModel_, NULL, 10, 0, 0, 10000, 2000);
+#ifdef CBC_THREAD
+                                    // threads search neighbourhoods at same time first
+                                    int numberThreads = parameters_[whichParam(CBC_PARAM_INT_THREADS, numberParameters_, parameters_)].intValue() % 100;
+                                    if (numberThreads > 1) {
+                                        localTree.setNumberNeighbourhoods(numberThreads);
+                                        // keep that many solutions to search round
+                                        if (babModel_->maximumSavedSolutions() < numberThreads - 1)
+                                            babModel_->setMaximumSavedSolutions(numberThreads - 1);
+                                    }
+#endif
                                     babModel_->passInTreeHandler(localTree);
                                 }
                             }
@@ -8134,7 +8242,9 @@ int CbcMain1 (int argc, const char *argv[],
 			    delete [] lotsize;
 #ifndef CBC_OTHER_SOLVER
                             ClpSimplex * lpSolver = clpSolver->getModelPtr();
-                            if (!gmpl) {
+                            if (isBinaryModel(fileName.c_str())) {
+                                status = readBinaryModel(clpSolver, fileName.c_str());
+                            } else if (!gmpl) {
                                 status = clpSolver->readMps(fileName.c_str(),
                                                             keepImportNames != 0,
                                                             allowImportErrors != 0);
@@ -22,6 +22,8 @@
 #include "OsiRowCutDebugger.hpp"
 #include "CbcThread.hpp"
 #include "CbcTree.hpp"
+#include "CbcPropagation.hpp"
+#include "CbcConflictStore.hpp"
 #include "CbcHeuristic.hpp"
 #include "CbcCutGenerator.hpp"
 #include "CbcModel.hpp"
@@ -31,6 +33,8 @@
 #include "OsiAuxInfo.hpp"
 
 #include "CoinTime.hpp"
+#include "CbcNodeTrace.hpp"
+#include "CbcProfile.hpp"
 #ifdef CBC_THREAD
 /// Thread functions
 static void * doNodesThread(void * voidInfo);
@@ -299,6 +303,7 @@ CbcThread::CbcThread()
         maxDeleteNode_(0),
         nodesThisTime_(0),
         iterationsThisTime_(0),
+        workUnitsThisTime_(0),
         deterministic_(0)
 {
 }
@@ -343,6 +348,7 @@ CbcThread::setUsefulStuff (CbcModel * model, int deterministic, CbcModel * baseM
     nDeleteNode_ = 0;
     nodesThisTime_ = 0;
     iterationsThisTime_ = 0;
+    workUnitsThisTime_ = 0;
     if (model != baseModel) {
         // thread
         thisModel_->setInfoInChild(-3, this);
@@ -528,7 +534,10 @@ CbcBaseModel::CbcBaseModel()
         numberObjects_(0),
         saveObjects_(NULL),
         defaultParallelIterations_(400),
-        defaultParallelNodes_(2)
+        defaultParallelNodes_(2),
+        threadWorkUnits_(NULL),
+        timeMergingOverlapped_(0.0),
+        timeMerging_(0.0)
 {
 }
 // Constructor with model
@@ -541,9 +550,14 @@ CbcBaseModel::CbcBaseModel (CbcModel & model,  int type)
         numberObjects_(0),
         saveObjects_(NULL),
         defaultParallelIterations_(400),
-        defaultParallelNodes_(2)
+        defaultParallelNodes_(2),
+        threadWorkUnits_(NULL),
+        timeMergingOverlapped_(0.0),
+        timeMerging_(0.0)
 {
     numberThreads_ = model.getNumberThreads();
+    if (model.getIntParam(CbcModel::CbcDeterministicWorkUnits) > 0)
+        defaultParallelIterations_ = model.getIntParam(CbcModel::CbcDeterministicWorkUnits);
     if (numberThreads_) {
         children_ = new CbcThread [numberThreads_+1];
         // Do a partial one for base model
@@ -556,6 +570,8 @@ CbcBaseModel::CbcBaseModel (CbcModel & model,  int type)
 #endif
         threadCount_ = new int [numberThreads_];
         CoinZeroN(threadCount_, numberThreads_);
+        threadWorkUnits_ = new double [numberThreads_];
+        CoinZeroN(threadWorkUnits_, numberThreads_);
         threadModel_ = new CbcModel * [numberThreads_+1];
         memset(threadStats_, 0, sizeof(threadStats_));
         if (type_ > 0) {
@@ -573,6 +589,13 @@ CbcBaseModel::CbcBaseModel (CbcModel & model,  int type)
             //threadModel_[i] = new CbcModel(model, true);
             threadModel_[i] = model. clone (true);
             threadModel_[i]->synchronizeHandlers(1);
+            // own ring in node trace (if room)
+            if (model.nodeTrace()) {
+                if (i + 1 < model.nodeTrace()->numberRings())
+                    threadModel_[i]->setNodeTrace(model.nodeTrace(), i + 1);
+                else
+                    threadModel_[i]->setNodeTrace(NULL);
+            }
 #ifdef COIN_HAS_CLP
             // Solver may need to know about model
             CbcModel * thisModel = threadModel_[i];
@@ -915,6 +938,20 @@ CbcBaseModel::waitForThreadsInTree(int type)
             << children_[i].timeLocked() << children_[i].timeWaitingToLock()
             << CoinMessageEol;
         }
+        if (type_ > 0) {
+            // work units are deterministic - times are not
+            char general[200];
+            for (i = 0; i < numberThreads_; i++) {
+                sprintf(general, "Thread %d did %g work units in %d rounds",
+                        i, threadWorkUnits_[i], threadCount_[i]);
+                baseModel->messageHandler()->message(CBC_GENERAL, baseModel->messages())
+                << general << CoinMessageEol ;
+            }
+            sprintf(general, "Merging took %.3f seconds of which %.3f overlapped with threads",
+                    timeMerging_, timeMergingOverlapped_);
+            baseModel->messageHandler()->message(CBC_GENERAL, baseModel->messages())
+            << general << CoinMessageEol ;
+        }
         assert (children_[numberThreads_].numberTimesLocked() == children_[numberThreads_].numberTimesUnlocked());
         baseModel->messageHandler()->message(CBC_THREAD_STATS, baseModel->messages())
         << "Main thread";
@@ -1032,26 +1069,43 @@ CbcBaseModel::deterministicParallel()
     for (iObject = 0; iObject < numberObjects_; iObject++) {
         saveObjects_[iObject]->updateBefore(object[iObject]);
     }
+    double scaleFactor = 1.0;
     //#define FAKE_PARALLEL
 #ifndef FAKE_PARALLEL
     for (iThread = 0; iThread < numberThreads_; iThread++) {
         children_[iThread].setReturnCode( 0);
         children_[iThread].signal();
     }
-    // wait
-    bool finished = false;
+    /*
+      Merge threads strictly in thread order but as soon as each one is
+      finished, so merging overlaps with work in later threads. Order is
+      fixed and a thread's budget is in work units (not time) so the result
+      is still deterministic.
+    */
+    int nextToMerge = 0;
     double time = getTime();
-    while (!finished) {
-        children_[numberThreads_].waitNano( 1000000); // millisecond
-        finished = true;
-        for (iThread = 0; iThread < numberThreads_; iThread++) {
-            if (children_[iThread].returnCode() <= 0) {
-                finished = false;
+    while (nextToMerge < numberThreads_) {
+        if (children_[nextToMerge].returnCode() > 0) {
+            // only overlapped if some later thread is still working
+            bool overlapped = false;
+            for (int jThread = nextToMerge + 1; jThread < numberThreads_; jThread++) {
+                if (children_[jThread].returnCode() == 0) {
+                    overlapped = true;
+                    break;
+                }
             }
+            double time2 = getTime();
+            mergeDeterministicThread(nextToMerge, saveTreeSize, scaleFactor);
+            children_[nextToMerge].setReturnCode(-1);
+            nextToMerge++;
+            double mergeTime = getTime() - time2;
+            timeMerging_ += mergeTime;
+            if (overlapped)
+                timeMergingOverlapped_ += mergeTime;
+        } else {
+            children_[numberThreads_].waitNano( 1000000); // millisecond
         }
     }
-    for (iThread = 0; iThread < numberThreads_; iThread++)
-        children_[iThread].setReturnCode(-1);
 #else
     // wait
     bool finished = false;
@@ -1063,31 +1117,22 @@ CbcBaseModel::deterministicParallel()
 	  children_[numberThreads_].waitNano( 1000000); // millisecond
 	  finished = (children_[iThread].returnCode() >0);
 	}
+        mergeDeterministicThread(iThread, saveTreeSize, scaleFactor);
         children_[iThread].setReturnCode(-1);
 	finished=false;
     }
 #endif
     children_[numberThreads_].incrementTimeInThread(getTime() - time);
-    // Unmark marked
+    // Now safe to delete nodes and unmark marked
+    for (iThread = 0; iThread < numberThreads_; iThread++) {
+        CbcThread * stuff = children_ + iThread;
+        for (int i = 0; i < stuff->nDeleteNode(); i++)
+            delete stuff->delNode()[i];
+        stuff->setNDeleteNode(0);
+    }
     for (int i = 0; i < nAffected; i++) {
         baseModel->walkback()[i]->unmark();
     }
-    int iModel;
-    double scaleFactor = 1.0;
-    for (iModel = 0; iModel < numberThreads_; iModel++) {
-        //printf("model %d tree size %d\n",iModel,threadModel[iModel]->baseModel->tree()->size());
-        if (saveTreeSize > 4*numberThreads_*defaultParallelNodes_) {
-            if (!threadModel[iModel]->tree()->size()) {
-                scaleFactor *= 1.05;
-            }
-        }
-        threadModel[iModel]->moveToModel(baseModel, 11);
-        // Update base model
-        OsiObject ** threadObject = threadModel[iModel]->objects();
-        for (iObject = 0; iObject < numberObjects_; iObject++) {
-            object[iObject]->updateAfter(threadObject[iObject], saveObjects_[iObject]);
-        }
-    }
     if (scaleFactor != 1.0) {
         int newNumber = static_cast<int> (defaultParallelNodes_ * scaleFactor + 0.5001);
         if (newNumber*2 < defaultParallelIterations_) {
@@ -1106,10 +1151,32 @@ CbcBaseModel::deterministicParallel()
     }
     delete [] threadModel;
 }
+// Merge results of one finished thread into base model (deterministic)
+void
+CbcBaseModel::mergeDeterministicThread(int iThread, int saveTreeSize,
+                                       double & scaleFactor)
+{
+    CbcModel * baseModel = children_[0].baseModel();
+    CbcModel * threadModel = children_[iThread].thisModel();
+    if (saveTreeSize > 4*numberThreads_*defaultParallelNodes_) {
+        if (!threadModel->tree()->size()) {
+            scaleFactor *= 1.05;
+        }
+    }
+    threadWorkUnits_[iThread] += children_[iThread].workUnitsThisTime();
+    threadModel->moveToModel(baseModel, 11);
+    // Update base model
+    OsiObject ** object = baseModel->objects();
+    OsiObject ** threadObject = threadModel->objects();
+    for (int iObject = 0; iObject < numberObjects_; iObject++) {
+        object[iObject]->updateAfter(threadObject[iObject], saveObjects_[iObject]);
+    }
+}
 // Destructor
 CbcBaseModel::~CbcBaseModel()
 {
     delete [] threadCount_;
+    delete [] threadWorkUnits_;
 #if 1
     for (int i = 0; i < numberThreads_; i++)
         delete threadModel_[i];
@@ -1251,6 +1318,9 @@ static void * doNodesThread(void * voidInfo)
                 thisModel->setSolutionCount(thisModel->getSolutionCount() - numberSolutions);
                 stuff->setNodesThisTime(thisModel->getNodeCount() - nodesThisTime);
                 stuff->setIterationsThisTime(thisModel->getIterationCount() - iterationsThisTime);
+                stuff->setWorkUnitsThisTime(NODE_ITERATIONS * ((thisModel->getNodeCount() - nodesThisTime) +
+                                                               ((thisModel->numberStrongIterations() - strongThisTime) >> 1)) +
+                                            thisModel->getIterationCount() - iterationsThisTime);
                 stuff->setNDeleteNode(nDeleteNode);
                 stuff->setReturnCode( returnCode);
                 thisModel->setNumberThreads(mode);
@@ -1531,6 +1601,10 @@ CbcModel::moveToModel(CbcModel * baseModel, int mode)
         baseModel->numberIterations_ +=
             numberIterations_ - numberFixedAtRoot_;
         baseModel->numberSolves_ += numberSolves_;
+        baseModel->treeLeafWeight_ += treeLeafWeight_;
+        baseModel->treeLeafSum_ += treeLeafSum_;
+        treeLeafWeight_ = 0.0;
+        treeLeafSum_ = 0.0;
         if (stuff->node())
             baseModel->tree_->push(stuff->node());
         if (stuff->createdNode())
@@ -1557,11 +1631,30 @@ CbcModel::moveToModel(CbcModel * baseModel, int mode)
             generator->incrementNumberCutsInTotal(generator2->numberCutsInTotal());
             generator->incrementNumberCutsActive(generator2->numberCutsActive());
             generator->incrementTimeInCutGenerator(generator2->timeInCutGenerator());
+            generator->addAccounting(generator2);
         }
         if (parallelMode() >= 0)
             nodeCompare_ = NULL;
         baseModel->maximumDepthActual_ = CoinMax(baseModel->maximumDepthActual_, maximumDepthActual_);
         baseModel->numberDJFixed_ += numberDJFixed_;
+        baseModel->timeInReducedCostFix_ += timeInReducedCostFix_;
+        baseModel->numberSolutionChecks_ += numberSolutionChecks_;
+        baseModel->numberQuickChecks_ += numberQuickChecks_;
+        baseModel->numberCompressedBases_ += numberCompressedBases_;
+        baseModel->compressedBasisBytes_ += compressedBasisBytes_;
+        baseModel->uncompressedBasisBytes_ += uncompressedBasisBytes_;
+        baseModel->numberCutCandidates_ += numberCutCandidates_;
+        baseModel->numberCutsSelected_ += numberCutsSelected_;
+        baseModel->timeInCutSelection_ += timeInCutSelection_;
+        baseModel->numberCutResolves_ += numberCutResolves_;
+        baseModel->cutResolveRows_ += cutResolveRows_;
+        baseModel->timeInCutResolves_ += timeInCutResolves_;
+        if (baseModel->profile_ && profile_)
+            baseModel->profile_->addThread(*profile_);
+        if (propagation_ && baseModel->propagation_)
+            baseModel->propagation_->addStatistics(*propagation_);
+        if (conflicts_ && baseModel->conflicts_)
+            baseModel->conflicts_->addStatistics(*conflicts_);
         baseModel->numberStrongIterations_ += numberStrongIterations_;
         int i;
         for (i = 0; i < 3; i++)
@@ -1700,8 +1793,13 @@ CbcModel::moveToModel(CbcModel * baseModel, int mode)
                 //usedInSolution_[i]=0;
             }
             baseModel->numberSolutions_ += numberSolutions_;
+            baseModel->treeLeafWeight_ += treeLeafWeight_;
+            baseModel->treeLeafSum_ += treeLeafSum_;
+            treeLeafWeight_ = 0.0;
+            treeLeafSum_ = 0.0;
             if (bestObjective_ < baseModel->bestObjective_ && bestObjective_ < baseModel->getCutoff()) {
                 baseModel->bestObjective_ = bestObjective_ ;
+                baseModel->addTimelinePoint();
                 int numberColumns = solver_->getNumCols();
                 if (!baseModel->bestSolution_)
                     baseModel->bestSolution_ = new double[numberColumns];
@@ -1754,13 +1852,22 @@ CbcModel::moveToModel(CbcModel * baseModel, int mode)
                     }
                     baseModel->tree_->push(node);
                 } else {
-                    delete node;
+                    /* other threads may still be running so leave
+                       deletion to CbcBaseModel::deterministicParallel */
+                    int nDeleteNode = stuff->nDeleteNode();
+                    if (nDeleteNode == stuff->maxDeleteNode()) {
+                        int maxDeleteNode = (3 * nDeleteNode) / 2 + 10;
+                        CbcNode ** delNode = new CbcNode * [maxDeleteNode];
+                        for (i = 0; i < nDeleteNode; i++)
+                            delNode[i] = stuff->delNode()[i];
+                        delete [] stuff->delNode();
+                        stuff->setDelNode(delNode);
+                        stuff->setMaxDeleteNode(maxDeleteNode);
+                    }
+                    stuff->delNode()[nDeleteNode] = node;
+                    stuff->setNDeleteNode(nDeleteNode + 1);
                 }
             }
-            for (i = 0; i < stuff->nDeleteNode(); i++) {
-                //printf("CbcNode %x stuff delete\n",stuff->delNode[i]);
-                delete stuff->delNode()[i];
-            }
         }
     } else {
         abort();
@@ -1925,8 +2032,8 @@ CbcModel::parallelCuts(CbcBaseModel * master, OsiCuts & theseCuts,
             }
         }
     }
-    // Add in any violated saved cuts
-    if (!theseCuts.sizeRowCuts() && !theseCuts.sizeColCuts()) {
+    // Add in any violated saved cuts (every pass if aging)
+    if ((!theseCuts.sizeRowCuts() && !theseCuts.sizeColCuts()) || cutAge_) {
         int numberOld = theseCuts.sizeRowCuts() + lastNumberCuts;
         int numberCuts = slackCuts.sizeRowCuts() ;
         int i;
@@ -1942,6 +2049,8 @@ CbcModel::parallelCuts(CbcBaseModel * master, OsiCuts & theseCuts,
                            thisCut->violated(cbcColSolution_)) ;
                 whichGenerator_[numberOld++] = 999;
                 theseCuts.insert(*thisCut) ;
+                if (cutAge_)
+                    numberHeldCutsAdded_++;
             }
         }
     }
@@ -280,6 +280,14 @@ public:
     inline void setIterationsThisTime(int value) {
         iterationsThisTime_ = value;
     }
+    /// Get work units (iterations plus weighted nodes) this time
+    inline int workUnitsThisTime() const {
+        return workUnitsThisTime_;
+    }
+    /// Set work units this time
+    inline void setWorkUnitsThisTime(int value) {
+        workUnitsThisTime_ = value;
+    }
     /// Get save stuff array
     inline int * saveStuff() {
         return saveStuff_;
@@ -313,6 +321,7 @@ public: // private:
     int maxDeleteNode_;
     int nodesThisTime_;
     int iterationsThisTime_;
+    int workUnitsThisTime_;
     int deterministic_;
 #ifdef THREAD_DEBUG
 public:
@@ -402,6 +411,12 @@ public:
 
 private:
 
+    /** Merge results of one finished thread into base model (deterministic).
+        Nodes to be deleted are left for deletion once all threads finished
+        as node information may be shared with threads still running.
+    */
+    void mergeDeterministicThread(int iThread, int saveTreeSize, double & scaleFactor);
+
     /// Number of children
     int numberThreads_;
     /// Child models (with base model at end)
@@ -417,6 +432,12 @@ private:
     int threadStats_[6];
     int defaultParallelIterations_;
     int defaultParallelNodes_;
+    /// Work units done by each thread in deterministic mode
+    double * threadWorkUnits_;
+    /// Time main thread spent merging while threads still running
+    double timeMergingOverlapped_;
+    /// Total time main thread spent merging
+    double timeMerging_;
 };
 #else
 // Dummy threads
@@ -10,6 +10,7 @@
 #include "CbcCountRowCut.hpp"
 #include "CbcCompareActual.hpp"
 #include "CbcBranchActual.hpp"
+#include "CoinTime.hpp"
 
 
 #if CBC_DEBUG_HEAP > 0
@@ -146,6 +147,13 @@ CbcTree::CbcTree()
     maximumBranching_ = 0;
     branched_ = NULL;
     newBound_ = NULL;
+    handler_ = NULL;
+    messages_ = NULL;
+    numberRebuildThreads_ = 0;
+    numberRebuilds_ = 0;
+    timeInRebuild_ = 0.0;
+    maximumRebuildTime_ = 0.0;
+    lastRebuildTime_ = 0.0;
 }
 CbcTree::~CbcTree()
 {
@@ -166,6 +174,13 @@ CbcTree::CbcTree ( const CbcTree & rhs)
         branched_ = NULL;
         newBound_ = NULL;
     }
+    handler_ = rhs.handler_;
+    messages_ = rhs.messages_;
+    numberRebuildThreads_ = rhs.numberRebuildThreads_;
+    numberRebuilds_ = rhs.numberRebuilds_;
+    timeInRebuild_ = rhs.timeInRebuild_;
+    maximumRebuildTime_ = rhs.maximumRebuildTime_;
+    lastRebuildTime_ = rhs.lastRebuildTime_;
 }
 // Assignment operator
 CbcTree &
@@ -185,16 +200,137 @@ CbcTree::operator=(const CbcTree & rhs)
             branched_ = NULL;
             newBound_ = NULL;
         }
+        handler_ = rhs.handler_;
+        messages_ = rhs.messages_;
+        numberRebuildThreads_ = rhs.numberRebuildThreads_;
+        numberRebuilds_ = rhs.numberRebuilds_;
+        timeInRebuild_ = rhs.timeInRebuild_;
+        maximumRebuildTime_ = rhs.maximumRebuildTime_;
+        lastRebuildTime_ = rhs.lastRebuildTime_;
     }
     return *this;
 }
+// Set message handler (not owned)
+void
+CbcTree::setMessageHandler(CoinMessageHandler * handler, CoinMessages * messages)
+{
+    handler_ = handler;
+    messages_ = messages;
+}
+
+namespace {
+/*
+  Standard sift down for a heap stored as in std::make_heap (children of i
+  are 2i+1 and 2i+2). Any array satisfying the heap property is a valid
+  heap for std::push_heap and std::pop_heap.
+*/
+void siftDownNode(CbcNode ** heap, int n, int i, CbcCompare & compare)
+{
+    CbcNode * value = heap[i];
+    while (true) {
+        int child = 2 * i + 1;
+        if (child >= n)
+            break;
+        if (child + 1 < n && compare(heap[child], heap[child+1]))
+            child++;
+        if (!compare(value, heap[child]))
+            break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = value;
+}
+#ifdef CBC_THREAD
+// Below this size rebuild is always serial
+#define CBC_PARALLEL_HEAP_MINIMUM 50000
+typedef struct {
+    CbcNode ** heap;
+    CbcCompare compare;
+    int numberNodes;
+    int firstRoot; // first subtree root owned by this thread
+    int lastRoot; // one past last subtree root
+} CbcHeapThreadInfo;
+/*
+  Heapify the subtrees rooted at [firstRoot,lastRoot). Descendants at each
+  level below the roots form a contiguous range, so go level by level from
+  the bottom up.
+*/
+void * doHeapThread(void * voidInfo)
+{
+    CbcHeapThreadInfo * info = reinterpret_cast<CbcHeapThreadInfo *>(voidInfo);
+    CbcNode ** heap = info->heap;
+    int n = info->numberNodes;
+    int numberLevels = 0;
+    int first = info->firstRoot;
+    while (first < n) {
+        numberLevels++;
+        first = 2 * first + 1;
+    }
+    for (int iLevel = numberLevels - 1; iLevel >= 0; iLevel--) {
+        int start = ((info->firstRoot + 1) << iLevel) - 1;
+        int end = CoinMin(((info->lastRoot + 1) << iLevel) - 1, n);
+        for (int i = end - 1; i >= start; i--)
+            siftDownNode(heap, n, i, info->compare);
+    }
+    return NULL;
+}
+#endif
+} // end file-local namespace
 
 /*
   Rebuild the heap.
+
+  With threads, the subtrees below a level with at least one root per thread
+  are heapified independently and then the few levels above are done serially.
 */
 void CbcTree::rebuild ()
 {
+  double startTime = CoinGetTimeOfDay();
+  int n = static_cast<int>(nodes_.size());
+  int numberThreads = 0;
+#ifdef CBC_THREAD
+  if (numberRebuildThreads_ > 1 && n >= CBC_PARALLEL_HEAP_MINIMUM) {
+    numberThreads = numberRebuildThreads_;
+    int numberRoots = 1;
+    while (numberRoots < numberThreads)
+      numberRoots *= 2;
+    // roots of subtrees are numberRoots-1 ... 2*numberRoots-2
+    int firstRoot = numberRoots - 1;
+    CbcNode ** heap = &nodes_[0];
+    CbcHeapThreadInfo * info = new CbcHeapThreadInfo [numberThreads];
+    Coin_pthread_t * threadId = new Coin_pthread_t [numberThreads];
+    for (int i = 0; i < numberThreads; i++) {
+      info[i].heap = heap;
+      info[i].compare = comparison_;
+      info[i].numberNodes = n;
+      info[i].firstRoot = firstRoot + (i * numberRoots) / numberThreads;
+      info[i].lastRoot = firstRoot + ((i + 1) * numberRoots) / numberThreads;
+      pthread_create(&(threadId[i].thr), NULL, doHeapThread, info + i);
+    }
+    for (int i = 0; i < numberThreads; i++)
+      pthread_join(threadId[i].thr, NULL);
+    delete [] threadId;
+    delete [] info;
+    // now levels above subtrees
+    for (int i = firstRoot - 1; i >= 0; i--)
+      siftDownNode(heap, n, i, comparison_);
+  } else {
+    std::make_heap(nodes_.begin(), nodes_.end(), comparison_);
+  }
+#else
   std::make_heap(nodes_.begin(), nodes_.end(), comparison_);
+#endif
+  lastRebuildTime_ = CoinGetTimeOfDay() - startTime;
+  timeInRebuild_ += lastRebuildTime_;
+  maximumRebuildTime_ = CoinMax(maximumRebuildTime_, lastRebuildTime_);
+  numberRebuilds_++;
+  if (handler_ && handler_->logLevel() > 2) {
+    char general[200];
+    sprintf(general, "Heap rebuild of %d nodes took %.4f seconds (%d threads)",
+            n, lastRebuildTime_, CoinMax(numberThreads, 1));
+    handler_->message(CBC_GENERAL, *messages_)
+    << general << CoinMessageEol ;
+  }
 # if CBC_DEBUG_HEAP > 1
   std::cout << "  HEAP: rebuild complete." << std::endl ;
 # endif
@@ -556,13 +692,13 @@ CbcTree::cleanTree(CbcModel * model, double cutoff, double & bestPossibleObjecti
     int kDelete = nNodes;
     bestPossibleObjective = 1.0e100 ;
     /*
-        Destructively scan the heap. Nodes to be retained go into the front of
+        Scan the heap in storage order (heap order does not matter as it is
+        rebuilt in bulk). Nodes to be retained go into the front of
         nodeArray, nodes to be deleted into the back. Store the depth in a
         correlated array for nodes to be deleted.
     */
     for (j = 0; j < nNodes; j++) {
-        CbcNode * node = top();
-        pop();
+        CbcNode * node = nodes_[j];
         double value = node ? node->objectiveValue() : COIN_DBL_MAX;
         if (node && value >= cutoff) {
             // double check in case node can change its mind!
@@ -570,6 +706,7 @@ CbcTree::cleanTree(CbcModel * model, double cutoff, double & bestPossibleObjecti
         }
         if (value >= cutoff || !node->active()) {
             if (node) {
+                node->setOnTree(false);
 	        if (cutoff<-1.0e30)
 		  node->nodeInfo()->deactivate(7);
                 nodeArray[--kDelete] = node;
@@ -581,11 +718,13 @@ CbcTree::cleanTree(CbcModel * model, double cutoff, double & bestPossibleObjecti
         }
     }
     /*
-      Rebuild the heap using the retained nodes.
+      Rebuild the heap using the retained nodes - one make heap rather than
+      a push for each node.
     */
-    for (j = 0; j < k; j++) {
-        push(nodeArray[j]);
-    }
+    nodes_.resize(k);
+    if (k)
+        CoinMemcpyN(nodeArray, k, &nodes_[0]);
+    rebuild();
 #   if CBC_DEBUG_HEAP > 1
     std::cout << " cleanTree: finished rebuild." << std::endl ;
 #   endif
@@ -629,6 +768,9 @@ CbcTree::cleanTree(CbcModel * model, double cutoff, double & bestPossibleObjecti
         //assert (node->nodeInfo());
         int numberLeft = (node->nodeInfo()) ? node->nodeInfo()->numberBranchesLeft() : 0;
 	if (cutoff != -COIN_DBL_MAX) {
+	  // unexplored branches are leaves for tree size estimate
+	  for (int i = 0; i < numberLeft; i++)
+	    model->recordTreeLeaf(depth[j] + 1);
 	  // normal
 	  for (int i = 0; i < model->currentNumberCuts(); i++) {
             // take off node
@@ -13,6 +13,9 @@
 #include "CoinHelperFunctions.hpp"
 #include "CbcCompare.hpp"
 
+class CoinMessageHandler;
+class CoinMessages;
+
 /*! \brief Using MS heap implementation
 
   It's unclear if this is needed any longer, or even if it should be allowed.
@@ -96,10 +99,34 @@ public:
     */
     virtual CbcNode * bestNode(double cutoff);
 
-    /*! \brief Rebuild the heap */
+    /*! \brief Rebuild the heap
+
+      Elapsed (wall clock) time for each rebuild is recorded, as it is
+      a pause for any thread waiting on the tree. With threads enabled
+      and a large heap the rebuild is done bottom up in parallel.
+    */
     virtual void rebuild() ;
 //@}
 
+    /*! \name Rebuild statistics and control */
+//@{
+    /// Set number of threads which may be used for rebuilding heap (0 serial)
+    inline void setNumberRebuildThreads(int value) { numberRebuildThreads_ = value; }
+    /// Get number of threads which may be used for rebuilding heap
+    inline int numberRebuildThreads() const { return numberRebuildThreads_; }
+    /** Set message handler (not owned) - if log level > 2 each rebuild
+        is logged with its pause time */
+    void setMessageHandler(CoinMessageHandler * handler, CoinMessages * messages);
+    /// Number of heap rebuilds (including those from cleanTree)
+    inline int numberRebuilds() const { return numberRebuilds_; }
+    /// Total elapsed seconds in heap rebuilds
+    inline double timeInRebuild() const { return timeInRebuild_; }
+    /// Longest single rebuild in seconds
+    inline double maximumRebuildTime() const { return maximumRebuildTime_; }
+    /// Elapsed seconds of last rebuild
+    inline double lastRebuildTime() const { return lastRebuildTime_; }
+//@}
+
     /*! \name Direct node access methods */
 //@{
     /// Test for an empty tree
@@ -214,6 +241,20 @@ protected:
     unsigned int * branched_;
     /// New bound
     int * newBound_;
+    /// Message handler for rebuild logging (not owned)
+    CoinMessageHandler * handler_;
+    /// Messages for rebuild logging (not owned)
+    CoinMessages * messages_;
+    /// Number of threads for rebuilding heap (0 serial)
+    int numberRebuildThreads_;
+    /// Number of heap rebuilds
+    int numberRebuilds_;
+    /// Total elapsed time in heap rebuilds
+    double timeInRebuild_;
+    /// Maximum elapsed time of one rebuild
+    double maximumRebuildTime_;
+    /// Elapsed time of last rebuild
+    double lastRebuildTime_;
 };
 
 #ifdef JJF_ZERO // not used
@@ -3,13 +3,71 @@
 // Corporation and others.  All Rights Reserved.
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
+#include "CbcConfig.h"
+
 #include "CbcModel.hpp"
 #include "CbcNode.hpp"
 #include "CbcTreeLocal.hpp"
+#include "CbcCutGenerator.hpp"
+#include "CbcEventHandler.hpp"
 #include "CoinPackedMatrix.hpp"
 #include "CoinTime.hpp"
 #include "OsiRowCutDebugger.hpp"
 #include <cassert>
+#ifdef CBC_THREAD
+#include "CbcThread.hpp"
+#endif
+namespace {
+// What neighbourhood searches share
+typedef struct {
+    double bestObjective; // minimization
+    double increment;
+#ifdef CBC_THREAD
+    pthread_mutex_t * mutex;
+#endif
+} CbcLocalShared;
+/*
+  Gives search's best to others and tightens cutoff from theirs
+*/
+class CbcLocalEventHandler : public CbcEventHandler {
+public:
+    CbcLocalEventHandler(CbcLocalShared * shared)
+            : CbcEventHandler(),
+            shared_(shared) {}
+    virtual CbcEventHandler * clone() const {
+        return new CbcLocalEventHandler(*this);
+    }
+    virtual CbcAction event(CbcEvent whichEvent) {
+        if (whichEvent == node || whichEvent == solution ||
+                whichEvent == heuristicSolution) {
+            double value = model_->getMinimizationObjValue();
+#ifdef CBC_THREAD
+            pthread_mutex_lock(shared_->mutex);
+#endif
+            if (value < shared_->bestObjective)
+                shared_->bestObjective = value;
+            double cutoff = shared_->bestObjective - shared_->increment;
+#ifdef CBC_THREAD
+            pthread_mutex_unlock(shared_->mutex);
+#endif
+            if (cutoff < model_->getCutoff())
+                model_->setCutoff(cutoff);
+        }
+        return noAction;
+    }
+    virtual CbcAction event(CbcEvent whichEvent, void * /*data*/) {
+        return event(whichEvent);
+    }
+private:
+    CbcLocalShared * shared_;
+};
+void * doNeighbourhoodThread(void * voidModel)
+{
+    CbcModel * model = reinterpret_cast<CbcModel *>(voidModel);
+    model->branchAndBound();
+    return NULL;
+}
+}
 #ifdef JJF_ZERO
 // gdb doesn't always put breakpoints in this virtual function
 // just stick xxxxxx() where you want to start
@@ -39,7 +97,8 @@ CbcTreeLocal::CbcTreeLocal()
         nodeLimit_(0),
         startNode_(-1),
         searchType_(-1),
-        refine_(false)
+        refine_(false),
+        numberNeighbourhoods_(0)
 {
 
 }
@@ -72,7 +131,8 @@ CbcTreeLocal::CbcTreeLocal(CbcModel * model, const double * solution ,
         nodeLimit_(nodeLimit),
         startNode_(-1),
         searchType_(-1),
-        refine_(refine)
+        refine_(refine),
+        numberNeighbourhoods_(0)
 {
 
     OsiSolverInterface * solver = model_->solver();
@@ -211,7 +271,8 @@ CbcTreeLocal::CbcTreeLocal ( const CbcTreeLocal & rhs)
         nodeLimit_(rhs.nodeLimit_),
         startNode_(rhs.startNode_),
         searchType_(rhs.searchType_),
-        refine_(rhs.refine_)
+        refine_(rhs.refine_),
+        numberNeighbourhoods_(rhs.numberNeighbourhoods_)
 {
     cut_ = rhs.cut_;
     fixedCut_ = rhs.fixedCut_;
@@ -275,6 +336,7 @@ CbcTreeLocal::operator=(const CbcTreeLocal & rhs)
         startNode_ = rhs.startNode_;
         searchType_ = rhs.searchType_;
         refine_ = rhs.refine_;
+        numberNeighbourhoods_ = rhs.numberNeighbourhoods_;
         delete [] originalLower_;
         delete [] originalUpper_;
         if (rhs.originalLower_) {
@@ -364,6 +426,9 @@ CbcTreeLocal::push(CbcNode * x)
         startNode_ = model_->getNodeCount();
         // save copy of node
         localNode_ = new CbcNode(*x);
+        // try several neighbourhoods at once (will move cut if better)
+        if (numberNeighbourhoods_ > 0 && model_->numberSavedSolutions())
+            searchNeighbourhoods();
 
         if (cut_.row().getNumElements()) {
             // Add to global cuts
@@ -869,6 +934,126 @@ CbcTreeLocal::deleteCut(OsiRowCut & cut)
                i, n, rowCut->lb(), rowCut->ub());
     global->eraseRowCut(i);
 }
+// Search neighbourhoods of best solutions at same time
+int
+CbcTreeLocal::searchNeighbourhoods()
+{
+    if (!model_ || typeCuts_ < 0 || numberNeighbourhoods_ <= 0)
+        return 0;
+    int numberIntegers = model_->numberIntegers();
+    const int * integerVariable = model_->integerVariable();
+    CbcLocalShared shared;
+    shared.increment = model_->getCutoffIncrement();
+#ifdef CBC_THREAD
+    pthread_mutex_t mutex;
+    pthread_mutex_init(&mutex, NULL);
+    shared.mutex = &mutex;
+#endif
+    CbcLocalEventHandler handler(&shared);
+    CbcModel ** models = new CbcModel * [numberNeighbourhoods_];
+    double saveRhs = rhs_;
+    int numberImproved = 0;
+    int numberPasses = 0;
+    while (true) {
+        double maximumSeconds = model_->getMaximumSeconds() -
+                                model_->getCurrentSeconds();
+        maximumSeconds = CoinMin(maximumSeconds, static_cast<double> (timeLimit_));
+        int numberSolutions = CoinMin(model_->numberSavedSolutions(),
+                                      numberNeighbourhoods_);
+        if (maximumSeconds <= 0.0 || !numberSolutions)
+            break;
+        double bestObjective = model_->getMinimizationObjValue();
+        shared.bestObjective = bestObjective;
+        int numberModels = 0;
+        for (int i = 0; i < numberNeighbourhoods_; i++) {
+            // more neighbourhoods than solutions - go wider
+            int which = i % numberSolutions;
+            rhs_ = range_ * (1 + i / numberSolutions);
+            OsiRowCut cut;
+            if (createCut(model_->savedSolution(which), cut))
+                continue; // bad or cut is everything
+            // solver may have local bounds
+            OsiSolverInterface * solver = model_->solver()->clone();
+            for (int j = 0; j < numberIntegers; j++) {
+                int iColumn = integerVariable[j];
+                solver->setColLower(iColumn, originalLower_[j]);
+                solver->setColUpper(iColumn, originalUpper_[j]);
+            }
+            solver->applyRowCut(cut);
+            solver->setHintParam(OsiDoReducePrint, true, OsiHintTry);
+            CbcModel * subModel = new CbcModel(*solver);
+            delete solver;
+            subModel->setLogLevel(0);
+            // mark as small branch and bound
+            subModel->setSpecialOptions(subModel->specialOptions() | 2048);
+            subModel->setMaximumNodes(nodeLimit_);
+            // cpu time would count all threads
+            subModel->setUseElapsedTime(true);
+            subModel->setMaximumSeconds(maximumSeconds);
+            subModel->setCutoff(model_->getCutoff());
+            subModel->passInEventHandler(&handler);
+            for (int j = 0; j < model_->numberCutGenerators(); j++) {
+                CbcCutGenerator * generator = model_->cutGenerator(j);
+                subModel->addCutGenerator(generator->generator(),
+                                          generator->howOften(),
+                                          generator->cutGeneratorName());
+            }
+            models[numberModels++] = subModel;
+        }
+        if (!numberModels)
+            break;
+#ifdef CBC_THREAD
+        Coin_pthread_t * threadId = new Coin_pthread_t [numberModels];
+        for (int i = 0; i < numberModels; i++)
+            pthread_create(&(threadId[i].thr), NULL, doNeighbourhoodThread,
+                           models[i]);
+        for (int i = 0; i < numberModels; i++)
+            pthread_join(threadId[i].thr, NULL);
+        delete [] threadId;
+#else
+        for (int i = 0; i < numberModels; i++)
+            doNeighbourhoodThread(models[i]);
+#endif
+        // pass solutions to model (worse ones may be saved)
+        for (int i = 0; i < numberModels; i++) {
+            CbcModel * subModel = models[i];
+            if (subModel->bestSolution()) {
+                double value = subModel->getMinimizationObjValue();
+                double oldValue = model_->getMinimizationObjValue();
+                // CBC_ROUNDING is symbolic; just says found by heuristic
+                model_->setBestSolution(CBC_ROUNDING, value,
+                                        subModel->bestSolution());
+                if (model_->getMinimizationObjValue() < oldValue)
+                    numberImproved++;
+            }
+            delete subModel;
+        }
+        numberPasses++;
+        if (model_->messageHandler()->logLevel() > 1)
+            printf("%d neighbourhoods searched (pass %d) - best solution %g\n",
+                   numberModels, numberPasses,
+                   model_->getMinimizationObjValue());
+        if (model_->getMinimizationObjValue() >= bestObjective)
+            break;
+    }
+    delete [] models;
+#ifdef CBC_THREAD
+    pthread_mutex_destroy(&mutex);
+#endif
+    rhs_ = saveRhs;
+    if (numberImproved) {
+        // local branching now round best - unless no cut (as
+        // passInSolution would then switch off local tree)
+        OsiRowCut cut;
+        rhs_ = range_;
+        if (createCut(model_->bestSolution(), cut) >= 0)
+            passInSolution(model_->bestSolution(),
+                           model_->getMinimizationObjValue());
+        else
+            rhs_ = saveRhs;
+    }
+    return numberImproved;
+}
 // Create C++ lines to get to current state
 void
 CbcTreeLocal::generateCpp( FILE * fp)
@@ -888,6 +1073,8 @@ CbcTreeLocal::generateCpp( FILE * fp)
         fprintf(fp, "5  localTree.setNodeLimit(%d);\n", nodeLimit_);
     if (refine_ != other.refine_)
         fprintf(fp, "5  localTree.setRefine(%s);\n", refine_ ? "true" : "false");
+    if (numberNeighbourhoods_ != other.numberNeighbourhoods_)
+        fprintf(fp, "5  localTree.setNumberNeighbourhoods(%d);\n", numberNeighbourhoods_);
     fprintf(fp, "5  cbcModel->passInTreeHandler(localTree);\n");
 }
 
@@ -151,6 +151,27 @@ public:
     inline void setRefine(bool yesNo) {
         refine_ = yesNo;
     }
+    // number of neighbourhoods searched at same time (0 off)
+    inline int numberNeighbourhoods() const {
+        return numberNeighbourhoods_;
+    }
+    /* number of neighbourhoods searched at same time (0 off).
+       If set then when search starts (and there is a solution) that many
+       neighbourhoods are searched first - see searchNeighbourhoods.
+       Model only keeps best solution unless
+       CbcModel::setMaximumSavedSolutions is used */
+    inline void setNumberNeighbourhoods(int value) {
+        numberNeighbourhoods_ = value;
+    }
+    /* Search neighbourhoods (range) of best saved solutions as small
+       branch and bounds all at same time (each on own thread if CBC_THREAD).
+       If more neighbourhoods than saved solutions then wider neighbourhoods
+       are used.  Node and time limits are as for subtree.  The searches
+       share cutoff and solutions are passed to model.  Repeats while
+       best solution improves.  The local branching cut is then moved
+       to the best solution if a cut can be made for it.
+       Returns number of improved solutions */
+    int searchNeighbourhoods();
 
 //@}
 private:
@@ -200,6 +221,8 @@ private:
     int searchType_;
     // Whether to do refinement step
     bool refine_;
+    // number of neighbourhoods searched at same time
+    int numberNeighbourhoods_;
 
 };
 
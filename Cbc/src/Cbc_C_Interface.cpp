@@ -7,12 +7,17 @@
 #include <cfloat>
 
 #include "CoinPragma.hpp"
-//#include "CoinHelperFunctions.hpp"
+#include "CoinHelperFunctions.hpp"
 //#include "CoinPackedMatrix.hpp"
 #include "CoinTime.hpp"
 
 #include "CbcModel.hpp"
 #include "CbcBranchActual.hpp"
+#include "CbcModelCache.hpp"
+#include "CbcProfile.hpp"
+#include "CbcBatchSolver.hpp"
+#include "CbcBorrowedMatrix.hpp"
+#include "CbcBinaryModel.hpp"
 
 #include "CoinMessageHandler.hpp"
 #include "OsiClpSolverInterface.hpp"
@@ -260,6 +265,7 @@ Cbc_deleteModel(Cbc_Model * model)
 
     if (VERBOSE > 1) printf("%s delete model->model_\n", prefix);
     fflush(stdout);
+    delete model->model_->modelCache();
     delete model->model_;
 
     if (VERBOSE > 1) printf("%s delete model->handler_\n", prefix);
@@ -325,6 +331,36 @@ Cbc_loadProblem (Cbc_Model * model,  const int numcols, const int numrows,
     if (VERBOSE > 0) printf("%s return\n", prefix);
 } //  Cbc_loadProblem()
 
+/* Loads a problem using caller's matrix arrays */
+COINLIBAPI void COINLINKAGE
+Cbc_loadProblemNoCopy (Cbc_Model * model,  const int numcols, const int numrows,
+                       const CoinBigIndex * start, const int* index,
+                       const double* value,
+                       const double* collb, const double* colub,
+                       const double* obj,
+                       const double* rowlb, const double* rowub)
+{
+    const char prefix[] = "Cbc_C_Interface::Cbc_loadProblemNoCopy(): ";
+//  const int  VERBOSE = 2;
+    if (VERBOSE > 0) printf("%s begin\n", prefix);
+
+    CbcModel * cbcModel = model->model_;
+    double peakBefore = CbcBorrowedMatrix::peakMemory();
+    bool noCopy = CbcBorrowedMatrix::loadProblem(cbcModel->solver(), numcols, numrows,
+                  start, index, value,
+                  collb, colub, obj, rowlb, rowub);
+    double peakAfter = CbcBorrowedMatrix::peakMemory();
+    char general[200];
+    sprintf(general, "Loaded %d rows, %d columns and %d elements %s - peak memory %.1f Mb before, %.1f Mb after",
+            numrows, numcols, static_cast<int> (start[numcols]),
+            noCopy ? "using caller's matrix" : "(matrix copied)",
+            peakBefore, peakAfter);
+    cbcModel->messageHandler()->message(CBC_GENERAL, cbcModel->messages())
+    << general << CoinMessageEol;
+
+    if (VERBOSE > 0) printf("%s return\n", prefix);
+} //  Cbc_loadProblemNoCopy()
+
 /* Read an mps file from the given filename */
 COINLIBAPI int COINLINKAGE
 Cbc_readMps(Cbc_Model * model, const char *filename)
@@ -370,6 +406,37 @@ Cbc_readLp(Cbc_Model * model, const char *filename)
     if (VERBOSE > 0) printf("%s return %i\n", prefix, result);
     return result;
 }
+/* Read a binary model file from the given filename */
+COINLIBAPI int COINLINKAGE
+Cbc_readBinary(Cbc_Model * model, const char *filename)
+{
+    const char prefix[] = "Cbc_C_Interface::Cbc_readBinary(): ";
+//  const int  VERBOSE = 2;
+    if (VERBOSE > 0) printf("%s begin\n", prefix);
+    if (VERBOSE > 1) printf("%s filename = '%s'\n", prefix, filename);
+    double time1 = CoinGetTimeOfDay();
+    int result = readBinaryModel(model->model_->solver(), filename);
+    if (VERBOSE > 1) printf("%s read in %.3f seconds - peak memory %.1f Mb\n",
+                                prefix, CoinGetTimeOfDay() - time1,
+                                CbcBorrowedMatrix::peakMemory());
+
+    if (VERBOSE > 0) printf("%s return %i\n", prefix, result);
+    return result;
+}
+/* Write a binary model file to the given filename */
+COINLIBAPI int COINLINKAGE
+Cbc_writeBinary(Cbc_Model * model, const char *filename)
+{
+    const char prefix[] = "Cbc_C_Interface::Cbc_writeBinary(): ";
+//  const int  VERBOSE = 2;
+    if (VERBOSE > 0) printf("%s begin\n", prefix);
+    if (VERBOSE > 1) printf("%s filename = '%s'\n", prefix, filename);
+
+    int result = writeBinaryModel(model->model_->solver(), filename);
+
+    if (VERBOSE > 0) printf("%s return %i\n", prefix, result);
+    return result;
+}
 
 
 COINLIBAPI void COINLINKAGE
@@ -563,6 +630,49 @@ Cbc_solve(Cbc_Model * model)
     }
     argv.push_back("-solve");
     argv.push_back("-quit");
+    CbcModel * cbcModel = model->model_;
+    CbcModelCache * cache = cbcModel->modelCache();
+    OsiSolverInterface * solver = cbcModel->solver();
+    int numberColumns = solver->getNumCols();
+    int numberRows = solver->getNumRows();
+    double * saveLower = NULL;
+    double * saveUpper = NULL;
+    if (cache) {
+        cache->resetReused();
+        // CbcMain1 changes bounds so keep them
+        saveLower = new double [numberColumns+numberRows];
+        saveUpper = new double [numberColumns+numberRows];
+        CoinMemcpyN(solver->getColLower(), numberColumns, saveLower);
+        CoinMemcpyN(solver->getColUpper(), numberColumns, saveUpper);
+        CoinMemcpyN(solver->getRowLower(), numberRows, saveLower + numberColumns);
+        CoinMemcpyN(solver->getRowUpper(), numberRows, saveUpper + numberColumns);
+        // Last incumbent moved into new bounds
+        double * solution = NULL;
+        int numberChanged = 0;
+        if (cbcModel->bestSolution()) {
+            solution = CoinCopyOfArray(cbcModel->bestSolution(), numberColumns);
+            for (int i = 0; i < numberColumns; i++) {
+                if (!solver->isInteger(i))
+                    continue;
+                double value = floor(solution[i] + 0.5);
+                value = CoinMax(value, ceil(saveLower[i] - 1.0e-9));
+                value = CoinMin(value, floor(saveUpper[i] + 1.0e-9));
+                if (value != floor(solution[i] + 0.5))
+                    numberChanged++;
+                solution[i] = value;
+            }
+        }
+        cbcModel->deleteSolutions();
+        cbcModel->setBestObjectiveValue(COIN_DBL_MAX);
+        cbcModel->setCutoff(1.0e50);
+        if (solution) {
+            // integers fixed and continuous resolved - only kept if feasible
+            cbcModel->setBestSolution(solution, numberColumns, COIN_DBL_MAX, true);
+            if (cbcModel->bestSolution())
+                cache->setReused(3, numberChanged ? 2 : 1);
+            delete [] solution;
+        }
+    }
     try {
         
         CbcMain1((int)argv.size(), &argv[0], *model->model_);
@@ -571,10 +681,83 @@ Cbc_solve(Cbc_Model * model)
                e.className().c_str(), e.methodName().c_str(), e.message().c_str());
     }
     result = model->model_->status();
+    if (cache) {
+        solver = cbcModel->solver();
+        // keep incumbent for next solve
+        if (!cbcModel->bestSolution() &&
+                cbcModel->getMinimizationObjValue() < 1.0e50)
+            cbcModel->setBestSolution(solver->getColSolution(), numberColumns,
+                                      cbcModel->getMinimizationObjValue());
+        solver->setColLower(saveLower);
+        solver->setColUpper(saveUpper);
+        for (int i = 0; i < numberRows; i++)
+            solver->setRowBounds(i, saveLower[numberColumns+i],
+                                 saveUpper[numberColumns+i]);
+        delete [] saveLower;
+        delete [] saveUpper;
+    }
 
     return result;
 }
 
+/* Solve models with shared setup */
+COINLIBAPI int COINLINKAGE
+Cbc_solveBatch(Cbc_Model ** models, int numberModels, int numberThreads,
+               int * status, double * seconds)
+{
+    const char prefix[] = "Cbc_C_Interface::Cbc_solveBatch(): ";
+//  const int  VERBOSE = 1;
+    if (VERBOSE > 0) printf("%s begin\n", prefix);
+
+    if (numberModels <= 0)
+        return 0;
+    CbcBatchSolver batch;
+    for (size_t i = 0; i < models[0]->cmdargs_.size(); i++)
+        batch.addArgument(models[0]->cmdargs_[i].c_str());
+    batch.setNumberThreads(numberThreads);
+    std::vector<CbcModel *> cbcModels(numberModels);
+    for (int i = 0; i < numberModels; i++)
+        cbcModels[i] = models[i]->model_;
+    int numberSolved = batch.solve(numberModels, &cbcModels[0]);
+    for (int i = 0; i < numberModels; i++) {
+        if (status)
+            status[i] = batch.status(i);
+        if (seconds)
+            seconds[i] = batch.seconds(i);
+    }
+
+    if (VERBOSE > 0) printf("%s return\n", prefix);
+    return numberSolved;
+}
+/* Incremental mode */
+COINLIBAPI void COINLINKAGE
+Cbc_setIncrementalSolve(Cbc_Model * model, int onOff)
+{
+    const char prefix[] = "Cbc_C_Interface::Cbc_setIncrementalSolve(): ";
+//  const int  VERBOSE = 1;
+    if (VERBOSE > 0) printf("%s begin\n", prefix);
+
+    CbcModelCache * cache = model->model_->modelCache();
+    if (onOff && !cache) {
+        // in memory
+        model->model_->setModelCache(new CbcModelCache());
+    } else if (!onOff && cache) {
+        delete cache;
+        model->model_->setModelCache(NULL);
+    }
+
+    if (VERBOSE > 0) printf("%s return\n", prefix);
+}
+/* What last solve reused */
+COINLIBAPI int COINLINKAGE
+Cbc_getIncrementalReuse(Cbc_Model * model, int * which)
+{
+    CbcModelCache * cache = model->model_->modelCache();
+    for (int i = 0; i < 4; i++)
+        which[i] = cache ? cache->reused(i) : 0;
+    return cache ? 1 : 0;
+}
+
 /* Sum of primal infeasibilities */
 COINLIBAPI double COINLINKAGE
 Cbc_sumPrimalInfeasibilities(Cbc_Model * /*model*/)
@@ -740,6 +923,73 @@ Cbc_isInteger(Cbc_Model * model, int i)
 }
 
 CbcGetProperty(int, getNodeCount)
+CbcGetProperty(double, getEstimatedTreeNodes)
+CbcGetProperty(double, getEstimatedSecondsLeft)
+
+COINLIBAPI double COINLINKAGE
+Cbc_getPrimalIntegral(Cbc_Model * model)
+{
+    return model->model_->primalIntegral();
+}
+
+COINLIBAPI double COINLINKAGE
+Cbc_getDualIntegral(Cbc_Model * model)
+{
+    return model->model_->dualIntegral();
+}
+
+COINLIBAPI double COINLINKAGE
+Cbc_getPrimalDualIntegral(Cbc_Model * model)
+{
+    return model->model_->primalDualIntegral();
+}
+
+COINLIBAPI int COINLINKAGE
+Cbc_getNumberTimelinePoints(Cbc_Model * model)
+{
+    return model->model_->numberTimelinePoints();
+}
+
+COINLIBAPI const double * COINLINKAGE
+Cbc_getTimeline(Cbc_Model * model)
+{
+    return model->model_->timeline();
+}
+
+COINLIBAPI void COINLINKAGE
+Cbc_setProfiling(Cbc_Model * model, int yesNo)
+{
+    const char prefix[] = "Cbc_C_Interface::Cbc_setProfiling(): ";
+//  const int  VERBOSE = 1;
+    if (VERBOSE > 0) printf("%s begin\n", prefix);
+
+    model->model_->setProfiling(yesNo != 0);
+
+    if (VERBOSE > 0) printf("%s return\n", prefix);
+}
+
+COINLIBAPI const char * COINLINKAGE
+Cbc_getProfileReport(Cbc_Model * model)
+{
+    return model->model_->profileReport();
+}
+
+COINLIBAPI double COINLINKAGE
+Cbc_getProfileSeconds(Cbc_Model * model, const char * section)
+{
+    const char prefix[] = "Cbc_C_Interface::Cbc_getProfileSeconds(): ";
+//  const int  VERBOSE = 1;
+    if (VERBOSE > 0) printf("%s begin\n", prefix);
+
+    double result = -1.0;
+    const CbcProfile * profile = model->model_->profile();
+    int iSection = CbcProfile::section(section);
+    if (profile && iSection >= 0)
+        result = profile->seconds(iSection);
+
+    if (VERBOSE > 0) printf("%s return %g\n", prefix, result);
+    return result;
+}
 
 /** Return a copy of this model */
 COINLIBAPI Cbc_Model * COINLINKAGE
@@ -754,6 +1004,9 @@ Cbc_clone(Cbc_Model * model)
     result->solver_    = dynamic_cast< OsiClpSolverInterface*> (result->model_->solver());
     result->handler_   = NULL;
     result->cmdargs_   = model->cmdargs_;
+    // clone has its own cache
+    if (model->model_->modelCache())
+        result->model_->setModelCache(new CbcModelCache(*model->model_->modelCache()));
 
     if (VERBOSE > 0) printf("%s return\n", prefix);
     return model;
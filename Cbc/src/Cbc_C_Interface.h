@@ -47,7 +47,9 @@ extern "C" {
        are *not valid* after calling Cbc_solve().
        Therefore it is not recommended to reuse a Cbc_Model
        object for multiple solves. A workaround is to call Cbc_clone()
-       before solving.
+       before solving.  The exception is incremental mode (see
+       Cbc_setIncrementalSolve) where bounds, objective and right hand
+       sides may be changed between solves.
      * */
     /*@{*/
     /** Loads a problem (the constraints on the
@@ -77,6 +79,22 @@ extern "C" {
                      const double* obj,
                      const double* rowlb, const double* rowub)
     ;
+    /** Loads a problem as Cbc_loadProblem but without copying the
+        constraint matrix - start, index and value are used where they are.
+        They must stay valid and unchanged until Cbc_deleteModel or another
+        problem is loaded; Cbc never frees them.  Bounds and objective are
+        copied.  Branch and bound works on copies so the matrix is only
+        copied when it is to be changed (e.g. by preprocessing or cuts).
+        Peak memory of the process before and after is printed.
+    */
+    COINLIBAPI void COINLINKAGE
+    Cbc_loadProblemNoCopy (Cbc_Model * model,  const int numcols, const int numrows,
+                           const CoinBigIndex * start, const int* index,
+                           const double* value,
+                           const double* collb, const double* colub,
+                           const double* obj,
+                           const double* rowlb, const double* rowub)
+    ;
     /** Read an mps file from the given filename */
     COINLIBAPI int COINLINKAGE
     Cbc_readMps(Cbc_Model * model, const char *filename)
@@ -89,6 +107,17 @@ extern "C" {
     COINLIBAPI int COINLINKAGE
     Cbc_readLp(Cbc_Model * model, const char *filename)
     ;
+    /** Read a binary model file (as written by cbc -exportbin) from
+        the given filename.  Returns 0 if ok, -1 if can not open,
+        1 if not a valid binary model file */
+    COINLIBAPI int COINLINKAGE
+    Cbc_readBinary(Cbc_Model * model, const char *filename)
+    ;
+    /** Write a binary model file to the given filename.
+        Returns 0 if ok */
+    COINLIBAPI int COINLINKAGE
+    Cbc_writeBinary(Cbc_Model * model, const char *filename)
+    ;
     /** Provide an initial feasible solution to accelerate branch-and-bound 
      Note that feasibility of the solution is *not* verified.
     */
@@ -260,6 +289,44 @@ extern "C" {
     COINLIBAPI int COINLINKAGE
     Cbc_solve(Cbc_Model * model)
     ;
+    /** Solve a number of independent models with the parameters set
+        (by Cbc_setParameter) on the first one.  Setup is shared and
+        models are spread over numberThreads threads if Cbc was built
+        thread safe.  Each model has its results as after Cbc_solve.
+        status and seconds (may be NULL) get status and wall clock time
+        of each model.  Returns number of models with a solution.
+    */
+    COINLIBAPI int COINLINKAGE
+    Cbc_solveBatch(Cbc_Model ** models, int numberModels, int numberThreads,
+                   int * status, double * seconds)
+    ;
+    /** Incremental mode (1 on, 0 off).
+        For solving a sequence of models which differ only in bounds,
+        objective and right hand sides.  Bounds are restored after each
+        Cbc_solve so the model may be changed and solved again.  Kept
+        from one solve to the next (if still valid) are
+        the optimal basis of the continuous relaxation,
+        pseudo costs,
+        root cuts (only if the new bounds are at least as tight, no
+        reduced cost fixing was done when they were generated and, if
+        there was a cutoff then, objective is same and cutoff no larger),
+        and the incumbent (integer values moved into the new bounds and
+        continuous values resolved).
+    */
+    COINLIBAPI void COINLINKAGE
+    Cbc_setIncrementalSolve(Cbc_Model * model, int onOff)
+    ;
+    /** What the last Cbc_solve reused in incremental mode.
+        which must have room for 4 values -
+        which[0] 1 if basis reused,
+        which[1] number of pseudo costs reused,
+        which[2] number of root cuts reused,
+        which[3] incumbent - 0 none, 1 still feasible, 2 repaired.
+        Returns 0 if not in incremental mode
+    */
+    COINLIBAPI int COINLINKAGE
+    Cbc_getIncrementalReuse(Cbc_Model * model, int * which)
+    ;
     /*@}*/
 
 
@@ -347,6 +414,54 @@ extern "C" {
     COINLIBAPI int COINLINKAGE
     Cbc_getNodeCount(Cbc_Model * model)
     ;
+    /** Estimated total number of nodes in B&B tree
+        (-1.0 if no estimate yet, updated at each log interval and
+        number of nodes once B&B completes) */
+    COINLIBAPI double COINLINKAGE
+    Cbc_getEstimatedTreeNodes(Cbc_Model * model)
+    ;
+    /** Estimated seconds until B&B completes (-1.0 if no estimate yet,
+        0.0 once B&B completes) */
+    COINLIBAPI double COINLINKAGE
+    Cbc_getEstimatedSecondsLeft(Cbc_Model * model)
+    ;
+    /** Primal integral of last B&B - integral over seconds of gap between
+        incumbent and best solution found (1 with no incumbent) */
+    COINLIBAPI double COINLINKAGE
+    Cbc_getPrimalIntegral(Cbc_Model * model)
+    ;
+    /** Dual integral of last B&B - as primal integral but for best bound */
+    COINLIBAPI double COINLINKAGE
+    Cbc_getDualIntegral(Cbc_Model * model)
+    ;
+    /** Primal-dual integral of last B&B - integral of gap between
+        incumbent and best bound */
+    COINLIBAPI double COINLINKAGE
+    Cbc_getPrimalDualIntegral(Cbc_Model * model)
+    ;
+    /** Number of points in incumbent and bound timeline of last B&B */
+    COINLIBAPI int COINLINKAGE
+    Cbc_getNumberTimelinePoints(Cbc_Model * model)
+    ;
+    /** Timeline as seconds, incumbent, best bound triples (minimization
+        sense, 1.0e50 before first solution) */
+    COINLIBAPI const double * COINLINKAGE
+    Cbc_getTimeline(Cbc_Model * model)
+    ;
+    /** Profile where time goes in B&B (1 on, 0 off) */
+    COINLIBAPI void COINLINKAGE
+    Cbc_setProfiling(Cbc_Model * model, int yesNo)
+    ;
+    /** Profile of last B&B as JSON ("" if not profiled) */
+    COINLIBAPI const char * COINLINKAGE
+    Cbc_getProfileReport(Cbc_Model * model)
+    ;
+    /** Seconds in section of last B&B ("node", "branch", "cutLoop",
+        "resolve", "addCuts", "heuristic", "propagation" or "tree").
+        -1.0 if not profiled or not known */
+    COINLIBAPI double COINLINKAGE
+    Cbc_getProfileSeconds(Cbc_Model * model, const char * section)
+    ;
     /** Print the solution */
     COINLIBAPI void  COINLINKAGE
     Cbc_printSolution(Cbc_Model * model)
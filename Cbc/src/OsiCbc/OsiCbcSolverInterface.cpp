@@ -41,6 +41,7 @@
 #include "OsiCuts.hpp"
 #include "OsiRowCut.hpp"
 #include "OsiColCut.hpp"
+#include "CbcBorrowedMatrix.hpp"
 #ifdef OSICBC_CLP_DFLT_SOLVER
 #include "ClpPresolve.hpp"
 #endif
@@ -388,7 +389,9 @@ OsiCbcSolverInterface::assignProblem(CoinPackedMatrix*& matrix,
 				     double*& obj,
 				     double*& rowlb, double*& rowub)
 {
-  modelPtr_->solver()->assignProblem(matrix,collb,colub,obj,rowlb,rowub);
+  // Clp takes over a column ordered matrix without copying
+  CbcBorrowedMatrix::assignProblem(modelPtr_->solver(),matrix,
+				   collb,colub,obj,rowlb,rowub);
 }
 
 //-----------------------------------------------------------------------------
@@ -430,6 +433,20 @@ OsiCbcSolverInterface::loadProblem(const int numcols, const int numrows,
 }
 //-----------------------------------------------------------------------------
 
+bool
+OsiCbcSolverInterface::loadProblemNoCopy(const int numcols, const int numrows,
+					 const CoinBigIndex * start, const int* index,
+					 const double* value,
+					 const double* collb, const double* colub,
+					 const double* obj,
+					 const double* rowlb, const double* rowub)
+{
+  return CbcBorrowedMatrix::loadProblem(modelPtr_->solver(),numcols,numrows,
+					start,index,value,
+					collb,colub,obj,rowlb,rowub);
+}
+//-----------------------------------------------------------------------------
+
 void
 OsiCbcSolverInterface::loadProblem(const int numcols, const int numrows,
 				   const CoinBigIndex * start, const int* index,
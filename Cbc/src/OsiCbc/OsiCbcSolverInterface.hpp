@@ -619,6 +619,19 @@ public:
                            const char* rowsen, const double* rowrhs,   
                            const double* rowrng);
 
+  /** Just like the loadProblem() method with a column major matrix except
+      that start, index and value are not copied.  The caller must keep them
+      valid and unchanged until this solver is deleted or another problem
+      is loaded and must not change coefficients or add or delete rows or
+      columns meanwhile (see CbcBorrowedMatrix).  Returns false if the
+      underlying solver is not Clp, in which case the matrix was copied. */
+  bool loadProblemNoCopy(const int numcols, const int numrows,
+                         const CoinBigIndex * start, const int* index,
+                         const double* value,
+                         const double* collb, const double* colub,   
+                         const double* obj,
+                         const double* rowlb, const double* rowub);
+
   using OsiSolverInterface::readMps ;
   /** Read an mps file from the given filename (defaults to Osi reader) - returns
       number of errors (see OsiMpsReader class) */
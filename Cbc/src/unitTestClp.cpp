@@ -4,17 +4,27 @@
 // This code is licensed under the terms of the Eclipse Public License (EPL).
 
 
+#include "CbcConfig.h"
+
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
 #include <string>
+#include <vector>
+#include <map>
 #include <iostream>
 #include <iomanip>
 
 #include "CoinTime.hpp"
 #include "CoinFileIO.hpp"
 #include "CbcModel.hpp"
+#include "CbcClpUnitTest.hpp"
 #include "CbcHeuristic.hpp"
 #include "CbcCutGenerator.hpp"
 #include "CbcBranchCut.hpp"
+#include "CbcCountRowCut.hpp"
+#include "CbcConflictStore.hpp"
 #include "CglProbing.hpp"
 #include "OsiClpSolverInterface.hpp"
 #include "ClpFactorization.hpp"
@@ -100,74 +110,19 @@ bool CbcTestMpsFile(std::string& fname)
 }
 //#############################################################################
 /*
-  jjf: testSwitch -2 unitTest, -1 normal (==2)
-
-  MiplibTest might be more appropriate.
-
-  TestSwitch and stuff[6] together control how much of miplib is executed:
-    For testSwitch set to:
-      -2: solve p0033 and p0201 only (the unit test)
-      -1: solve miplib sets #0 and #1
-       0: solve nothing
-       k: execute sets j:k, where j is determined by the value of stuff[6]
-  The last parameter of PUSH_MPS specifies the test set membership.
-
-  For -miplib, -extra2 sets testSwitch, -extra3 sets stuff[6]. The command
-    cbc -extra2 -2 -miplib
-  will execute the unit test on the miplib directory.
-
-  dirMiplib should end in the directory separator character for the platform.
-
-  If you want to activate the row cut debugger for a given problem, change the
-  last parameter of the PUSH_MPS macro for the problem to true.
-
-  Returns 0 if all goes well, -1 if the Miplib directory is missing, otherwise
-     100*(number with bad objective)+(number that exceeded node limit)
+  The miplib problems known to the unit test. testSwitch -2 gives just the
+  unit test problems, anything else all of miplib. Also used by the
+  benchmark harness for names and objective values.
 */
-int CbcClpUnitTest (const CbcModel &saveModel, const std::string &dirMiplib,
-                    int testSwitch, const double *stuff)
+static void CbcMiplibProblems (int testSwitch,
+                               std::vector<std::string> &mpsName,
+                               std::vector<int> &nRows,
+                               std::vector<int> &nCols,
+                               std::vector<double> &objValue,
+                               std::vector<double> &objValueC,
+                               std::vector<int> &testSet,
+                               std::vector<int> &rowCutDebugger)
 {
-  // Stop Windows popup
-  WindowsErrorPopupBlocker() ;
-  unsigned int m ;
-
-  // Do an existence check.
-  std::string test1 = dirMiplib+"p0033";
-  bool doTest = CbcTestMpsFile(test1);
-  if (!doTest) {
-    std::cout
-      << "Not doing miplib run as can't find mps files." << std::endl
-      << "Perhaps you're trying to read gzipped (.gz) files without libz?"
-      << std::endl ;
-    return (0) ;
-  }
-  int dfltPrecision = static_cast<int>(std::cout.precision()) ;
-/*
-  Set the range of problems to be tested. testSwitch = -2 is special and is
-  picked up below.
-*/
-    int loSet = 0 ;
-    int hiSet = 0 ;
-    if (testSwitch == -1) {
-      loSet = 0 ;
-      hiSet = 1 ;
-    } else if (testSwitch >= 0) {
-      loSet = static_cast<int>(stuff[6]) ;
-      hiSet = testSwitch ;
-      std::cout
-        << "Solving miplib problems in sets " << loSet
-	<< ":" << hiSet << "." << std::endl ;
-    }
-/*
-  Vectors to hold test problem names and characteristics.
-*/
-    std::vector<std::string> mpsName ;
-    std::vector<int> nRows ;
-    std::vector<int> nCols ;
-    std::vector<double> objValueC ;
-    std::vector<double> objValue ;
-    std::vector<int> testSet ;
-    std::vector<int> rowCutDebugger ;
 /*
   A macro to make the vector creation marginally readable. Parameters are
   name, rows, columns, integer objective, continuous objective, set ID,
@@ -267,6 +222,80 @@ int CbcClpUnitTest (const CbcModel &saveModel, const std::string &dirMiplib,
 #endif
   }
 #undef PUSH_MPS
+}
+
+//#############################################################################
+/*
+  jjf: testSwitch -2 unitTest, -1 normal (==2)
+
+  MiplibTest might be more appropriate.
+
+  TestSwitch and stuff[6] together control how much of miplib is executed:
+    For testSwitch set to:
+      -2: solve p0033 and p0201 only (the unit test)
+      -1: solve miplib sets #0 and #1
+       0: solve nothing
+       k: execute sets j:k, where j is determined by the value of stuff[6]
+  The last parameter of PUSH_MPS specifies the test set membership.
+
+  For -miplib, -extra2 sets testSwitch, -extra3 sets stuff[6]. The command
+    cbc -extra2 -2 -miplib
+  will execute the unit test on the miplib directory.
+
+  dirMiplib should end in the directory separator character for the platform.
+
+  If you want to activate the row cut debugger for a given problem, change the
+  last parameter of the PUSH_MPS macro for the problem to true.
+
+  Returns 0 if all goes well, -1 if the Miplib directory is missing, otherwise
+     100*(number with bad objective)+(number that exceeded node limit)
+*/
+int CbcClpUnitTest (const CbcModel &saveModel, const std::string &dirMiplib,
+                    int testSwitch, const double *stuff)
+{
+  // Stop Windows popup
+  WindowsErrorPopupBlocker() ;
+  unsigned int m ;
+
+  // Do an existence check.
+  std::string test1 = dirMiplib+"p0033";
+  bool doTest = CbcTestMpsFile(test1);
+  if (!doTest) {
+    std::cout
+      << "Not doing miplib run as can't find mps files." << std::endl
+      << "Perhaps you're trying to read gzipped (.gz) files without libz?"
+      << std::endl ;
+    return (0) ;
+  }
+  int dfltPrecision = static_cast<int>(std::cout.precision()) ;
+/*
+  Set the range of problems to be tested. testSwitch = -2 is special and is
+  picked up below.
+*/
+    int loSet = 0 ;
+    int hiSet = 0 ;
+    if (testSwitch == -1) {
+      loSet = 0 ;
+      hiSet = 1 ;
+    } else if (testSwitch >= 0) {
+      loSet = static_cast<int>(stuff[6]) ;
+      hiSet = testSwitch ;
+      std::cout
+        << "Solving miplib problems in sets " << loSet
+	<< ":" << hiSet << "." << std::endl ;
+    }
+/*
+  Vectors to hold test problem names and characteristics.
+*/
+    std::vector<std::string> mpsName ;
+    std::vector<int> nRows ;
+    std::vector<int> nCols ;
+    std::vector<double> objValueC ;
+    std::vector<double> objValue ;
+    std::vector<int> testSet ;
+    std::vector<int> rowCutDebugger ;
+    CbcMiplibProblems(testSwitch, mpsName, nRows, nCols, objValue, objValueC,
+                      testSet, rowCutDebugger) ;
 
 /*
   Normally the problems are executed in order. Define RANDOM_ORDER below to
@@ -596,6 +625,102 @@ int CbcClpUnitTest (const CbcModel &saveModel, const std::string &dirMiplib,
       model->setMoreSpecialOptions(moreOptions|4194304);
     }
 #endif
+#ifdef CBC_THREAD
+/*
+  Deterministic thread scaling. With -extra1 1 and deterministic threads
+  (e.g. -threads 108) first solve with 1,2,4... up to the given number of
+  threads and report elapsed time and speedup against one thread. Node
+  counts should not depend on timing so are printed as a check.
+*/
+    if (stuff && stuff[5] == 1.0 && (model->getThreadMode()&1) != 0 &&
+	model->getNumberThreads() > 1) {
+      int maxThreads = model->getNumberThreads();
+      double baseTime = 0.0;
+      int nThreads = 1;
+      while (true) {
+	CbcModel scaleModel(*model);
+	scaleModel.setNumberThreads(nThreads);
+	double wallTime = CoinGetTimeOfDay();
+	scaleModel.branchAndBound();
+	wallTime = CoinGetTimeOfDay() - wallTime;
+	if (nThreads == 1)
+	  baseTime = wallTime;
+	std::cout
+	  << "cbc_clp (" << mpsName[m] << ") " << nThreads << " threads "
+	  << wallTime << " seconds, speedup " << baseTime / CoinMax(wallTime, 1.0e-6)
+	  << ", " << scaleModel.getNodeCount() << " nodes, "
+	  << scaleModel.getIterationCount() << " iterations, objective "
+	  << std::setprecision(10) << scaleModel.getObjValue()
+	  << std::setprecision(dfltPrecision) << std::endl ;
+	if (nThreads == maxThreads)
+	  break;
+	nThreads = CoinMin(2 * nThreads, maxThreads);
+      }
+    }
+/*
+  Parallel mini trees. For the unit test problems also solve as with
+  -threads 1602 (two threads used below CbcGeneralDepth rather than in the
+  tree search) and check the answer.
+*/
+    if (testSwitch == -2 && siClp) {
+      CbcModel lookModel(*model);
+      lookModel.setNumberThreads(2);
+      lookModel.setThreadMode(16);
+      if (lookModel.fastNodeDepth() < 0)
+	lookModel.setFastNodeDepth(3);
+      lookModel.branchAndBound();
+      std::cout
+	<< "cbc_clp (" << mpsName[m] << ") threads 1602 "
+	<< std::setprecision(10) << lookModel.getObjValue() ;
+      if (!lookModel.status() &&
+	  fabs(lookModel.getObjValue()-objValue[m]) >
+	  CoinMax(1.0e-5,1.0e-5*fabs(objValue[m]))) {
+	std::cout << " != " << objValue[m] << "; error" ;
+	numberFailures++;
+      } else {
+	std::cout << "; okay" ;
+      }
+      std::cout
+	<< std::setprecision(dfltPrecision)
+	<< " -- (" << lookModel.getNodeCount() << " n / "
+	<< lookModel.getIterationCount() << " i)" << std::endl ;
+    }
+#endif
+/*
+  Conflicts. For the unit test problems also solve with propagation and
+  conflict learning and probing at every node so the tree carries cuts.
+  Nodes pruned by propagation or the conflict store must take their cuts
+  off so no cut should be deleted while still referenced.
+*/
+    if (testSwitch == -2) {
+      CbcModel conflictModel(*model);
+      conflictModel.setNumberThreads(0);
+      conflictModel.setNodePropagation(true);
+      conflictModel.setConflictLearning(true);
+      CglProbing probing;
+      conflictModel.addCutGenerator(&probing, 1, "ProbingEveryNode");
+      int numberBefore = CbcCountRowCut::numberDeletedReferenced();
+      conflictModel.branchAndBound();
+      int numberLeft = CbcCountRowCut::numberDeletedReferenced() - numberBefore;
+      const CbcConflictStore * conflicts = conflictModel.conflictStore();
+      int numberPruned = conflicts ? conflicts->numberPruned() : 0;
+      std::cout
+	<< "cbc_clp (" << mpsName[m] << ") conflicts "
+	<< std::setprecision(10) << conflictModel.getObjValue()
+	<< std::setprecision(dfltPrecision)
+	<< ", " << numberPruned << " nodes pruned by conflicts, "
+	<< numberLeft << " cuts left referenced" ;
+      if (numberLeft || (!conflictModel.status() &&
+	  fabs(conflictModel.getObjValue()-objValue[m]) >
+	  CoinMax(1.0e-5,1.0e-5*fabs(objValue[m])))) {
+	std::cout << "; error" ;
+	numberFailures++;
+      } else {
+	std::cout << "; okay" ;
+      }
+      std::cout
+	<< " -- (" << conflictModel.getNodeCount() << " n)" << std::endl ;
+    }
 /*
   Finally, the actual call to solve the MIP with branch-and-cut.
 */
@@ -724,3 +849,478 @@ int CbcClpUnitTest (const CbcModel &saveModel, const std::string &dirMiplib,
   return (returnCode) ;
 }
 
+
+//#############################################################################
+/*
+  Benchmark harness.
+
+  CbcClpUnitTest checks answers on a fixed list. CbcClpBenchmark measures:
+  it runs a benchmark file of problems, parameter sets, seeds and thread
+  counts and writes one line per run to a results file, and
+  CbcClpBenchmarkCompare compares two results files. See
+  test/cbcBenchmark.cpp and the benchmark target in test/Makefile.am.
+
+  A benchmark file has one keyword per line ('#' starts a comment)
+
+    name <label>                   label written with results (default
+                                   the benchmark file name)
+    seconds <limit>                elapsed time limit for a run (3600)
+    seeds <seed> ...               random seeds (1)
+    threads <number> ...           thread counts (0)
+    settings <name> [options]      cbc options for a parameter set - may be
+                                   repeated (default "default", no options)
+    miplib <set>                   unit test miplib problems in sets 0:set
+    instance <name> [objective]    problem in dirMiplib and its optimal
+                                   objective if known (from the unit test
+                                   list if not given)
+
+  Each run goes through CbcMain1 so options mean what they mean to cbc. The
+  seed goes to CbcModel::setRandomSeed and CoinDrand48 and time is elapsed.
+  A results line is
+
+    label problem settings seed threads status seconds nodes iterations
+      objective bound gap primalIntegral dualIntegral primalDualIntegral
+      gapHistory
+
+  status is optimal, infeasible, limit, wrong (finished but not the known
+  objective) or error. seconds includes reading and preprocessing.
+  Integrals come from the model's timeline (see CbcModel::primalIntegral)
+  with the known objective as reference if there is one.
+  gapHistory is time:gap pairs from the timeline each time the
+  primal-dual gap moved by a tenth of itself.
+*/
+namespace {
+// Relative gap as in primal integral (1.0 if no value or signs differ)
+double benchmarkGap(double value, double reference)
+{
+  if (value >= 1.0e30 || value <= -1.0e30 ||
+      reference >= 1.0e30 || reference <= -1.0e30)
+    return 1.0;
+  if (fabs(value - reference) < 1.0e-9)
+    return 0.0;
+  if (value * reference < 0.0)
+    return 1.0;
+  return fabs(value - reference) /
+	 CoinMax(fabs(value), fabs(reference));
+}
+// One line of results file
+typedef struct {
+  std::string problem;
+  std::string status;
+  double seconds;
+  double nodes;
+  double iterations;
+  double primalIntegral;
+  double primalDualIntegral;
+} CbcBenchmarkResult;
+// Field of results line (0 first) as double
+double benchmarkField(const char * line, int which)
+{
+  const char * field = line;
+  for (int i = 0; i < which && field; i++) {
+    field = strchr(field, ' ');
+    if (field)
+      field++;
+  }
+  return field ? atof(field) : 0.0;
+}
+/* Read results file into map from "problem seed threads settings" (label
+   in name).  Settings are numbered in order so different parameter sets
+   can be compared */
+bool readBenchmarkResults(const char * fileName,
+			  std::map<std::string, CbcBenchmarkResult> & results,
+			  std::vector<std::string> & order,
+			  std::string & name)
+{
+  FILE * fp = fopen(fileName, "r");
+  if (!fp)
+    return false;
+  std::vector<std::string> settingsName ;
+  char line[10000];
+  while (fgets(line, sizeof(line), fp)) {
+    char label[200], problem[200], settings[200], status[20];
+    int seed, threads;
+    CbcBenchmarkResult result;
+    if (line[0] == '#' ||
+	sscanf(line, "%199s %199s %199s %d %d %19s %lg %lg %lg",
+	       label, problem, settings, &seed, &threads, status,
+	       &result.seconds, &result.nodes, &result.iterations) != 9)
+      continue;
+    result.primalIntegral = benchmarkField(line, 12);
+    result.primalDualIntegral = benchmarkField(line, 14);
+    result.problem = problem;
+    result.status = status;
+    name = label;
+    size_t iSettings = 0;
+    while (iSettings < settingsName.size() && settingsName[iSettings] != settings)
+      iSettings++;
+    if (iSettings == settingsName.size())
+      settingsName.push_back(settings);
+    char key[500];
+    sprintf(key, "%s %d %d %d", problem, seed, threads,
+	    static_cast<int>(iSettings));
+    if (results.find(key) == results.end())
+      order.push_back(key);
+    results[key] = result;
+  }
+  fclose(fp);
+  return true;
+}
+}
+
+/*
+  Run benchmark file (see above) writing results to resultsFile.
+  Returns -1 if the benchmark or results file can not be opened, otherwise
+  the number of runs which gave a wrong answer or failed.
+*/
+int CbcClpBenchmark (const std::string &dirMiplib, const char *benchmarkFile,
+		     const char *resultsFile)
+{
+  FILE * fp = fopen(benchmarkFile, "r");
+  if (!fp) {
+    std::cout << "Unable to open benchmark file " << benchmarkFile
+	      << "." << std::endl ;
+    return -1;
+  }
+  std::string name = benchmarkFile;
+  double maximumSeconds = 3600.0;
+  std::vector<int> seeds ;
+  std::vector<int> threads ;
+  std::vector<std::string> settingsName ;
+  std::vector<std::vector<std::string> > settings ;
+  std::vector<std::string> problem ;
+  std::vector<double> optimal ;
+  // Known objectives
+  std::vector<std::string> mpsName ;
+  std::vector<int> nRows ;
+  std::vector<int> nCols ;
+  std::vector<double> objValueC ;
+  std::vector<double> objValue ;
+  std::vector<int> testSet ;
+  std::vector<int> rowCutDebugger ;
+  CbcMiplibProblems(-1, mpsName, nRows, nCols, objValue, objValueC,
+		    testSet, rowCutDebugger) ;
+  char line[10000];
+  while (fgets(line, sizeof(line), fp)) {
+    char * hash = strchr(line, '#');
+    if (hash)
+      *hash = '\0';
+    std::vector<std::string> word ;
+    for (char * token = strtok(line, " \t\r\n") ; token ;
+	 token = strtok(NULL, " \t\r\n"))
+      word.push_back(token);
+    if (!word.size())
+      continue;
+    const std::string & key = word[0];
+    if (key == "name" && word.size() > 1) {
+      name = word[1];
+    } else if (key == "seconds" && word.size() > 1) {
+      maximumSeconds = atof(word[1].c_str());
+    } else if (key == "seeds") {
+      for (size_t i = 1 ; i < word.size() ; i++)
+	seeds.push_back(atoi(word[i].c_str()));
+    } else if (key == "threads") {
+      for (size_t i = 1 ; i < word.size() ; i++)
+	threads.push_back(atoi(word[i].c_str()));
+    } else if (key == "settings" && word.size() > 1) {
+      settingsName.push_back(word[1]);
+      settings.push_back(std::vector<std::string>(word.begin() + 2,
+						  word.end()));
+    } else if (key == "miplib" && word.size() > 1) {
+      int hiSet = atoi(word[1].c_str());
+      for (size_t i = 0 ; i < mpsName.size() ; i++) {
+	if (testSet[i] <= hiSet) {
+	  problem.push_back(mpsName[i]);
+	  optimal.push_back(objValue[i]);
+	}
+      }
+    } else if (key == "instance" && word.size() > 1) {
+      double value = COIN_DBL_MAX;
+      if (word.size() > 2) {
+	value = atof(word[2].c_str());
+      } else {
+	for (size_t i = 0 ; i < mpsName.size() ; i++) {
+	  if (mpsName[i] == word[1])
+	    value = objValue[i];
+	}
+      }
+      problem.push_back(word[1]);
+      optimal.push_back(value);
+    } else {
+      std::cout << "Benchmark file line starting " << key
+		<< " not understood." << std::endl ;
+    }
+  }
+  fclose(fp);
+  if (!seeds.size())
+    seeds.push_back(1);
+  if (!threads.size())
+    threads.push_back(0);
+  if (!settings.size()) {
+    settingsName.push_back("default");
+    settings.push_back(std::vector<std::string>());
+  }
+  fp = fopen(resultsFile, "w");
+  if (!fp) {
+    std::cout << "Unable to open results file " << resultsFile
+	      << "." << std::endl ;
+    return -1;
+  }
+  fprintf(fp, "# label problem settings seed threads status seconds nodes"
+	  " iterations objective bound gap primalIntegral dualIntegral"
+	  " primalDualIntegral gapHistory\n");
+  int numberRuns = static_cast<int>(problem.size() * settings.size() *
+				    seeds.size() * threads.size());
+  int numberBad = 0;
+  int iRun = 0;
+  for (size_t iProblem = 0 ; iProblem < problem.size() ; iProblem++) {
+    std::string fn = dirMiplib + problem[iProblem] ;
+    bool found = CbcTestMpsFile(fn);
+    for (size_t iSettings = 0 ; iSettings < settings.size() ; iSettings++) {
+      for (size_t iSeed = 0 ; iSeed < seeds.size() ; iSeed++) {
+	for (size_t iThreads = 0 ; iThreads < threads.size() ; iThreads++) {
+	  iRun++;
+	  std::cout
+	    << "  benchmark run " << iRun << " out of " << numberRuns
+	    << ": " << problem[iProblem] << " " << settingsName[iSettings]
+	    << " seed " << seeds[iSeed] << " threads " << threads[iThreads]
+	    << std::endl ;
+	  if (!found) {
+	    std::cout << "ERROR: Cannot find MPS file " << fn << "." << std::endl ;
+	    fprintf(fp, "%s %s %s %d %d error 0 0 0 - - 1 0 0 0 -\n",
+		    name.c_str(), problem[iProblem].c_str(),
+		    settingsName[iSettings].c_str(), seeds[iSeed],
+		    threads[iThreads]);
+	    numberBad++;
+	    continue;
+	  }
+	  char seconds[30];
+	  sprintf(seconds, "%g", maximumSeconds);
+	  char numberThreads[30];
+	  sprintf(numberThreads, "%d", threads[iThreads]);
+	  std::vector<const char *> argv ;
+	  argv.push_back("cbc");
+	  argv.push_back("-log");
+	  argv.push_back("0");
+	  for (size_t i = 0 ; i < settings[iSettings].size() ; i++)
+	    argv.push_back(settings[iSettings][i].c_str());
+	  argv.push_back("-timeMode");
+	  argv.push_back("elapsed");
+	  argv.push_back("-seconds");
+	  argv.push_back(seconds);
+	  if (threads[iThreads]) {
+	    argv.push_back("-threads");
+	    argv.push_back(numberThreads);
+	  }
+	  argv.push_back("-import");
+	  argv.push_back(fn.c_str());
+	  argv.push_back("-solve");
+	  argv.push_back("-quit");
+	  CbcModel model;
+	  CbcMain0(model);
+	  model.setRandomSeed(seeds[iSeed]);
+	  CoinDrand48(true, seeds[iSeed]);
+	  double time = CoinGetTimeOfDay();
+	  int returnCode = CbcMain1(static_cast<int>(argv.size()), &argv[0],
+				    model);
+	  time = CoinGetTimeOfDay() - time;
+	  double sense = model.getObjSense();
+	  const char * status;
+	  double objActual = model.getObjValue();
+	  double objExpect = optimal[iProblem];
+	  bool haveSolution = model.getMinimizationObjValue() < 1.0e30;
+	  if (returnCode) {
+	    status = "error";
+	  } else if (model.isProvenOptimal()) {
+	    double tolerance = CoinMin(fabs(objActual), fabs(objExpect));
+	    tolerance = CoinMax(1.0e-5, 1.0e-5 * tolerance);
+	    if (objExpect < 1.0e30 && fabs(objActual - objExpect) >= tolerance)
+	      status = "wrong";
+	    else
+	      status = "optimal";
+	  } else if (model.isProvenInfeasible()) {
+	    status = objExpect < 1.0e30 ? "wrong" : "infeasible";
+	  } else if (model.status() == 1) {
+	    status = "limit";
+	  } else {
+	    status = "error";
+	  }
+	  if (!strcmp(status, "wrong") || !strcmp(status, "error"))
+	    numberBad++;
+	  double reference = (objExpect < 1.0e30) ? objExpect * sense :
+	    model.getMinimizationObjValue();
+	  std::string gapHistory ;
+	  double lastGap = 1.0;
+	  for (int i = 0 ; i < model.numberTimelinePoints() ; i++) {
+	    const double * point = model.timeline() + 3 * i;
+	    double gap = benchmarkGap(point[1], point[2]);
+	    if (fabs(gap - lastGap) >= CoinMax(1.0e-3, 0.1 * lastGap) ||
+		(gap == 0.0 && lastGap != 0.0)) {
+	      lastGap = gap;
+	      char temp[50];
+	      sprintf(temp, "%s%.2f:%.4g", gapHistory.size() ? "," : "",
+		      point[0], gap);
+	      gapHistory += temp;
+	    }
+	  }
+	  if (!gapHistory.size())
+	    gapHistory = "-";
+	  char objective[30];
+	  if (haveSolution)
+	    sprintf(objective, "%.12g", objActual);
+	  else
+	    strcpy(objective, "-");
+	  fprintf(fp, "%s %s %s %d %d %s %.3f %d %d %s %.12g %.6g %.4f %.4f %.4f %s\n",
+		  name.c_str(), problem[iProblem].c_str(),
+		  settingsName[iSettings].c_str(), seeds[iSeed],
+		  threads[iThreads], status, time, model.getNodeCount(),
+		  model.getIterationCount(), objective,
+		  model.getBestPossibleObjValue(),
+		  benchmarkGap(model.getMinimizationObjValue(),
+			       model.getBestPossibleObjValue() * sense),
+		  model.primalIntegral(reference),
+		  model.dualIntegral(reference),
+		  model.primalDualIntegral(), gapHistory.c_str());
+	  fflush(fp);
+	  std::cout
+	    << "cbc_clp (" << problem[iProblem] << ") " << status << " -- ("
+	    << model.getNodeCount() << " n / " << model.getIterationCount()
+	    << " i / " << time << " s)" << std::endl ;
+	}
+      }
+    }
+  }
+  fclose(fp);
+  std::cout
+    << "Benchmark " << name << " did " << numberRuns << " runs, "
+    << numberBad << " wrong or failed, results in " << resultsFile
+    << "." << std::endl ;
+  return numberBad;
+}
+
+/*
+  Compare two results files from CbcClpBenchmark run by run (same problem,
+  seed and threads) - normally same benchmark file with different code or
+  settings. Prints runs where status changed or shifted time changed by
+  more than 25% and, for time, nodes, iterations, primal integral and
+  primal-dual integral, shifted geometric means (shifts 10 seconds, 100
+  nodes, 1000 iterations and 10 for integrals) with a paired t test on log
+  ratios flagged significant at 95%
+  (if more than 1%).
+  Returns -1 if a file can not be read, 1 if any measure is significantly
+  worse in newFile, otherwise 0.
+*/
+int CbcClpBenchmarkCompare (const char *baseFile, const char *newFile)
+{
+  std::map<std::string, CbcBenchmarkResult> baseResults ;
+  std::map<std::string, CbcBenchmarkResult> newResults ;
+  std::vector<std::string> order ;
+  std::vector<std::string> newOrder ;
+  std::string baseName ;
+  std::string newName ;
+  if (!readBenchmarkResults(baseFile, baseResults, order, baseName)) {
+    std::cout << "Unable to read results file " << baseFile << "." << std::endl ;
+    return -1;
+  }
+  if (!readBenchmarkResults(newFile, newResults, newOrder, newName)) {
+    std::cout << "Unable to read results file " << newFile << "." << std::endl ;
+    return -1;
+  }
+  const int numberMeasures = 5;
+  const char * measureName[numberMeasures] =
+    {"time", "nodes", "iterations", "primalIntegral", "primalDual"};
+  const double shift[numberMeasures] = {10.0, 100.0, 1000.0, 10.0, 10.0};
+  double sumLog[2][numberMeasures];
+  double sumDiff[numberMeasures];
+  double sumDiff2[numberMeasures];
+  memset(sumLog, 0, sizeof(sumLog));
+  memset(sumDiff, 0, sizeof(sumDiff));
+  memset(sumDiff2, 0, sizeof(sumDiff2));
+  int numberMatched = 0;
+  int numberSolved[2] = {0, 0};
+  int numberWrong[2] = {0, 0};
+  printf("%-24s %-22s %10s %10s %7s\n", "problem seed threads set",
+	 "status", baseName.c_str(), newName.c_str(), "ratio");
+  for (size_t i = 0 ; i < order.size() ; i++) {
+    std::map<std::string, CbcBenchmarkResult>::const_iterator it =
+      newResults.find(order[i]);
+    if (it == newResults.end())
+      continue;
+    const CbcBenchmarkResult & result0 = baseResults[order[i]];
+    const CbcBenchmarkResult & result1 = it->second;
+    const CbcBenchmarkResult * result[2] = {&result0, &result1};
+    bool error = false;
+    for (int k = 0 ; k < 2 ; k++) {
+      if (result[k]->status == "optimal" || result[k]->status == "infeasible")
+	numberSolved[k]++;
+      else if (result[k]->status == "wrong")
+	numberWrong[k]++;
+      else if (result[k]->status == "error")
+	error = true;
+    }
+    if (error)
+      continue;
+    numberMatched++;
+    for (int j = 0 ; j < numberMeasures ; j++) {
+      double value[2];
+      for (int k = 0 ; k < 2 ; k++) {
+	const CbcBenchmarkResult & r = *result[k];
+	value[k] = (j == 0) ? r.seconds : (j == 1) ? r.nodes :
+	  (j == 2) ? r.iterations : (j == 3) ? r.primalIntegral :
+	  r.primalDualIntegral;
+	value[k] = log(CoinMax(value[k], 0.0) + shift[j]);
+	sumLog[k][j] += value[k];
+      }
+      double diff = value[1] - value[0];
+      sumDiff[j] += diff;
+      sumDiff2[j] += diff * diff;
+    }
+    double ratio = (result1.seconds + shift[0]) / (result0.seconds + shift[0]);
+    if (ratio > 1.25 || ratio < 0.8 || result0.status != result1.status) {
+      std::string status = result0.status + "/" + result1.status;
+      printf("%-24s %-22s %10.2f %10.2f %7.2f%s\n", order[i].c_str(),
+	     status.c_str(), result0.seconds, result1.seconds,
+	     result1.seconds / CoinMax(result0.seconds, 1.0e-3),
+	     result0.status != result1.status ? " !" : "");
+    }
+  }
+  printf("%d runs compared - solved %d and %d, wrong %d and %d\n",
+	 numberMatched, numberSolved[0], numberSolved[1],
+	 numberWrong[0], numberWrong[1]);
+  if (!numberMatched)
+    return 0;
+  // 95% two sided t values for 1 to 30 degrees of freedom
+  static const double tValue[30] = {
+    12.71, 4.30, 3.18, 2.78, 2.57, 2.45, 2.36, 2.31, 2.26, 2.23,
+    2.20, 2.18, 2.16, 2.14, 2.13, 2.12, 2.11, 2.10, 2.09, 2.09,
+    2.08, 2.07, 2.07, 2.06, 2.06, 2.06, 2.05, 2.05, 2.05, 2.04};
+  int degrees = numberMatched - 1;
+  double tCritical = degrees > 30 ? 1.96 : (degrees ? tValue[degrees-1] : 0.0);
+  int returnCode = 0;
+  printf("%-15s %12s %12s %7s %7s\n", "shifted geomean",
+	 baseName.c_str(), newName.c_str(), "ratio", "t");
+  for (int j = 0 ; j < numberMeasures ; j++) {
+    double mean0 = exp(sumLog[0][j] / numberMatched) - shift[j];
+    double mean1 = exp(sumLog[1][j] / numberMatched) - shift[j];
+    double meanDiff = sumDiff[j] / numberMatched;
+    double t = 0.0;
+    if (degrees) {
+      double variance = (sumDiff2[j] - numberMatched * meanDiff * meanDiff) /
+			degrees;
+      if (variance > 1.0e-20)
+	t = meanDiff / sqrt(variance / numberMatched);
+      else if (fabs(meanDiff) > 1.0e-10)
+	t = meanDiff > 0.0 ? COIN_DBL_MAX : -COIN_DBL_MAX;
+    }
+    // ignore tiny changes even if consistent
+    bool significant = degrees && fabs(t) > tCritical &&
+		       fabs(meanDiff) > 0.01;
+    printf("%-15s %12.2f %12.2f %7.3f %7.2f%s\n", measureName[j],
+	   mean0, mean1, exp(meanDiff), CoinMax(-999.99, CoinMin(t, 999.99)),
+	   significant ? (t > 0.0 ? " worse (significant)" :
+			  " better (significant)") : "");
+    if (significant && t > 0.0)
+      returnCode = 1;
+  }
+  return returnCode;
+}
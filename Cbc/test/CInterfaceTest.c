@@ -366,6 +366,205 @@ void testIntegerBounds() {
 
 }
 
+/* Knapsack of testKnapsack for tests below
+   Maximize  5x[1] + 3x[2] + 2x[3] + 7x[4] + 4x[5]
+   s.t.      2x[1] + 8x[2] + 4x[3] + 2x[4] + 5x[5] <= 10
+   All x binary
+   Best is 16 with x[1], x[4] and x[5]
+   */
+static CoinBigIndex knapsackStart[] = {0, 1, 2, 3, 4, 5};
+static int knapsackIndex[] = {0, 0, 0, 0, 0};
+static double knapsackValue[] = {2, 8, 4, 2, 5};
+static double knapsackLower[] = {0, 0, 0, 0, 0};
+static double knapsackUpper[] = {1, 1, 1, 1, 1};
+static double knapsackObj[] = {5, 3, 2, 7, 4};
+static double knapsackRowLower[] = {-INFINITY};
+static double knapsackRowUpper[] = {10};
+
+/* Makes all knapsack variables integer and maximizes */
+static void setKnapsackIntegers(Cbc_Model *model) {
+    int i;
+    for (i = 0; i < 5; i++)
+        Cbc_setInteger(model, i);
+    Cbc_setObjSense(model, -1);
+}
+
+static Cbc_Model *buildKnapsack(void) {
+    Cbc_Model *model = Cbc_newModel();
+    Cbc_loadProblem(model, 5, 1, knapsackStart, knapsackIndex, knapsackValue,
+                    knapsackLower, knapsackUpper, knapsackObj,
+                    knapsackRowLower, knapsackRowUpper);
+    setKnapsackIntegers(model);
+    return model;
+}
+
+void testEstimate() {
+    /* knapsack without cuts or heuristics so it branches */
+    Cbc_Model *model = buildKnapsack();
+
+    assert(Cbc_getEstimatedTreeNodes(model) == -1.0);
+    Cbc_setParameter(model, "log", "0");
+    Cbc_setParameter(model, "cuts", "off");
+    Cbc_setParameter(model, "heuristics", "off");
+    Cbc_setParameter(model, "preprocess", "off");
+    Cbc_solve(model);
+    assert(Cbc_isProvenOptimal(model));
+    assert(fabs(Cbc_getObjValue(model) - 16.0) < 1e-6);
+    assert(Cbc_getNodeCount(model) > 0);
+    /* estimates come back from the copy that was solved */
+    assert(Cbc_getEstimatedTreeNodes(model) >= Cbc_getNodeCount(model));
+    assert(Cbc_getEstimatedSecondsLeft(model) >= 0.0);
+
+    Cbc_deleteModel(model);
+}
+
+void testProfile() {
+    /* knapsack with time profiled - no cuts or heuristics so it branches */
+    Cbc_Model *model = buildKnapsack();
+    const char *report;
+
+    assert(Cbc_getProfileSeconds(model, "node") == -1.0);
+    assert(strlen(Cbc_getProfileReport(model)) == 0);
+    Cbc_setParameter(model, "log", "0");
+    Cbc_setParameter(model, "cuts", "off");
+    Cbc_setParameter(model, "heuristics", "off");
+    Cbc_setParameter(model, "preprocess", "off");
+    Cbc_setProfiling(model, 1);
+    Cbc_solve(model);
+    assert(Cbc_isProvenOptimal(model));
+    assert(fabs(Cbc_getObjValue(model) - 16.0) < 1e-6);
+
+    report = Cbc_getProfileReport(model);
+    assert(strlen(report) > 0);
+    assert(strstr(report, "\"node\"") != NULL);
+    assert(Cbc_getProfileSeconds(model, "node") >= 0.0);
+    assert(Cbc_getProfileSeconds(model, "cutLoop") >= 0.0);
+    assert(Cbc_getProfileSeconds(model, "noSuchSection") == -1.0);
+
+    Cbc_deleteModel(model);
+}
+
+void testIncremental() {
+    /* knapsack solved, x[4] fixed to 0, solved again */
+    Cbc_Model *model = buildKnapsack();
+    const double *sol;
+    int which[4];
+
+    Cbc_setIncrementalSolve(model, 1);
+
+    Cbc_solve(model);
+    assert(Cbc_isProvenOptimal(model));
+    assert(fabs(Cbc_getObjValue(model) - 16.0) < 1e-6);
+    assert(Cbc_getIncrementalReuse(model, which) == 1);
+
+    /* bounds restored after solve so can change them */
+    assert(fabs(Cbc_getColUpper(model)[3] - 1.0) < 1e-6);
+    Cbc_setColUpper(model, 3, 0.0);
+
+    Cbc_solve(model);
+    assert(Cbc_isProvenOptimal(model));
+    /* best is now x[1]+x[5] = 9 (x[1]+x[3] is only 7) */
+    assert(fabs(Cbc_getObjValue(model) - 9.0) < 1e-6);
+    sol = Cbc_getColSolution(model);
+    assert(fabs(sol[3]) < 1e-6);
+    assert(Cbc_getIncrementalReuse(model, which) == 1);
+    /* old incumbent had x[4]=1 so can not be reused as it was */
+    assert(which[3] != 1);
+
+    /* and back - old bounds again */
+    Cbc_setColUpper(model, 3, 1.0);
+    Cbc_solve(model);
+    assert(Cbc_isProvenOptimal(model));
+    assert(fabs(Cbc_getObjValue(model) - 16.0) < 1e-6);
+
+    Cbc_deleteModel(model);
+}
+
+void testBatch() {
+    /* knapsack with capacities 10, 4 and 2 solved together */
+    Cbc_Model *models[3];
+    double capacity[] = {10, 4, 2};
+    double best[] = {16, 12, 7};
+    int status[3];
+    double seconds[3];
+    int j;
+
+    for (j = 0; j < 3; j++) {
+        models[j] = buildKnapsack();
+        Cbc_setRowUpper(models[j], 0, capacity[j]);
+    }
+    Cbc_setParameter(models[0], "log", "0");
+
+    assert(Cbc_solveBatch(models, 3, 2, status, seconds) == 3);
+    for (j = 0; j < 3; j++) {
+        assert(Cbc_isProvenOptimal(models[j]));
+        assert(fabs(Cbc_getObjValue(models[j]) - best[j]) < 1e-6);
+        assert(seconds[j] >= 0.0);
+        Cbc_deleteModel(models[j]);
+    }
+}
+
+void testNoCopy() {
+    /* knapsack with matrix left in the arrays above */
+    Cbc_Model *model = Cbc_newModel();
+    const double *sol;
+
+    Cbc_loadProblemNoCopy(model, 5, 1, knapsackStart, knapsackIndex,
+                          knapsackValue, knapsackLower, knapsackUpper,
+                          knapsackObj, knapsackRowLower, knapsackRowUpper);
+    assert(Cbc_getNumCols(model) == 5);
+    assert(Cbc_getNumRows(model) == 1);
+    assert(Cbc_getNumElements(model) == 5);
+    setKnapsackIntegers(model);
+
+    Cbc_solve(model);
+    assert(Cbc_isProvenOptimal(model));
+    assert(fabs(Cbc_getObjValue(model) - 16.0) < 1e-6);
+    sol = Cbc_getColSolution(model);
+    assert(fabs(sol[1]) < 1e-6);
+    assert(fabs(sol[3] - 1.0) < 1e-6);
+    /* arrays untouched */
+    assert(knapsackValue[1] == 8 && knapsackStart[5] == 5);
+
+    Cbc_deleteModel(model);
+}
+
+void testBinary() {
+    /* knapsack written as binary model file and read back */
+    Cbc_Model *model = buildKnapsack();
+    Cbc_Model *model2 = Cbc_newModel();
+    const char * fileName = "CInterfaceTest.cbcbin";
+    FILE * fp;
+    int i;
+
+    assert(Cbc_writeBinary(model, fileName) == 0);
+
+    assert(Cbc_readBinary(model2, fileName) == 0);
+    assert(Cbc_getNumCols(model2) == 5);
+    assert(Cbc_getNumRows(model2) == 1);
+    assert(Cbc_getNumElements(model2) == 5);
+    assert(Cbc_getObjSense(model2) == -1);
+    for (i = 0; i < 5; i++)
+        assert(Cbc_isInteger(model2, i));
+    assert(fabs(Cbc_getRowUpper(model2)[0] - 10.0) < 1e-6);
+
+    Cbc_solve(model2);
+    assert(Cbc_isProvenOptimal(model2));
+    assert(fabs(Cbc_getObjValue(model2) - 16.0) < 1e-6);
+
+    /* not a binary model file */
+    fp = fopen(fileName, "w");
+    assert(fp);
+    fprintf(fp, "NAME not a binary model\n");
+    fclose(fp);
+    assert(Cbc_readBinary(model2, fileName) == 1);
+    remove(fileName);
+    assert(Cbc_readBinary(model2, fileName) == -1);
+
+    Cbc_deleteModel(model);
+    Cbc_deleteModel(model2);
+}
+
 
 int main() {
 
@@ -381,6 +580,18 @@ int main() {
     testProblemModification();*/
     printf("Integer bounds test\n");
     testIntegerBounds();
+    printf("Tree estimate test\n");
+    testEstimate();
+    printf("Profile test\n");
+    testProfile();
+    printf("Incremental test\n");
+    testIncremental();
+    printf("Batch test\n");
+    testBatch();
+    printf("No copy test\n");
+    testNoCopy();
+    printf("Binary model file test\n");
+    testBinary();
 
     return 0;
 }
@@ -0,0 +1,45 @@
+// $Id$
+// Copyright (C) 2026, Cbc contributors.
+// All Rights Reserved.
+// This code is licensed under the terms of the Eclipse Public License (EPL).
+
+#if defined(_MSC_VER)
+// Turn off compiler warning about long names
+#  pragma warning(disable:4786)
+#endif
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include "CoinHelperFunctions.hpp"
+#include "CbcClpUnitTest.hpp"
+
+/*
+  Benchmark driver - see CbcClpBenchmark in unitTestClp.cpp for the
+  benchmark file and results formats.
+
+  cbcBenchmark [-dirMiplib dir] benchmark.set results.res
+      solves everything in benchmark.set writing results.res
+  cbcBenchmark -compare base.res new.res
+      compares two results files, returns 1 if new is significantly worse
+*/
+int main (int argc, const char *argv[])
+{
+   WindowsErrorPopupBlocker();
+   if (argc == 4 && !strcmp(argv[1], "-compare"))
+      return CbcClpBenchmarkCompare(argv[2], argv[3]) ? 1 : 0;
+   std::string dirMiplib = "";
+   int iArg = 1;
+   if (argc > 2 && !strcmp(argv[1], "-dirMiplib")) {
+      dirMiplib = argv[2];
+      if (dirMiplib.size() && dirMiplib[dirMiplib.size()-1] != '/' &&
+            dirMiplib[dirMiplib.size()-1] != '\\')
+         dirMiplib += '/';
+      iArg = 3;
+   }
+   if (argc != iArg + 2) {
+      fprintf(stderr, "Usage: %s [-dirMiplib dir] benchmark.set results.res\n"
+              "       %s -compare base.res new.res\n", argv[0], argv[0]);
+      return 1;
+   }
+   return CbcClpBenchmark(dirMiplib, argv[iArg], argv[iArg+1]) ? 1 : 0;
+}